@@ -0,0 +1,292 @@
+/**
+ *  @name   admission
+ *  @brief  incremental RM admission control context caching per-service response times
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "admission.h"
+
+int admission_init(admission_ctx_t *ctx, U32_T capacity) {
+    memset(ctx, 0, sizeof(*ctx));
+
+    ctx->id       = malloc(sizeof(U32_T) * capacity);
+    ctx->period   = malloc(sizeof(U32_T) * capacity);
+    ctx->wcet     = malloc(sizeof(U32_T) * capacity);
+    ctx->deadline = malloc(sizeof(U32_T) * capacity);
+    ctx->resp     = malloc(sizeof(U32_T) * capacity);
+    ctx->trial    = malloc(sizeof(U32_T) * capacity);
+
+    if(!ctx->id || !ctx->period || !ctx->wcet || !ctx->deadline || !ctx->resp || !ctx->trial)
+    {
+        admission_destroy(ctx);
+        return -1;
+    }
+
+    ctx->capacity = capacity;
+    return 0;
+}
+
+int admission_reserve(admission_ctx_t *ctx, U32_T capacity) {
+    U32_T **cols[] = { &ctx->id, &ctx->period, &ctx->wcet, &ctx->deadline, &ctx->resp, &ctx->trial };
+    U32_T *grown;
+    U32_T k;
+
+    if(capacity <= ctx->capacity)
+        return 0;
+
+    // a column that fails leaves the ones already grown larger than capacity, which is harmless
+    for(k = 0; k < sizeof(cols) / sizeof(cols[0]); k++)
+    {
+        grown = realloc(*cols[k], sizeof(U32_T) * capacity);
+        if(grown == NULL)
+            return -1;
+        *cols[k] = grown;
+    }
+
+    ctx->capacity = capacity;
+    return 0;
+}
+
+void admission_clear(admission_ctx_t *ctx) {
+    ctx->count       = 0;
+    ctx->stale       = 0;
+    ctx->utilization = 0.0;
+}
+
+void admission_destroy(admission_ctx_t *ctx) {
+    free(ctx->id);
+    free(ctx->period);
+    free(ctx->wcet);
+    free(ctx->deadline);
+    free(ctx->resp);
+    free(ctx->trial);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+// open or close a one element gap at pos in every per-service column
+static void admission_shift(admission_ctx_t *ctx, U32_T pos, int open) {
+    U32_T *cols[] = { ctx->id, ctx->period, ctx->wcet, ctx->deadline, ctx->resp };
+    U32_T tail = ctx->count - pos - (open ? 0 : 1);
+    U32_T k;
+
+    for(k = 0; k < sizeof(cols) / sizeof(cols[0]); k++)
+    {
+        if(open)
+            memmove(cols[k] + pos + 1, cols[k] + pos, sizeof(U32_T) * tail);
+        else
+            memmove(cols[k] + pos, cols[k] + pos + 1, sizeof(U32_T) * tail);
+    }
+}
+
+static U32_T admission_find(const admission_ctx_t *ctx, U32_T id) {
+    U32_T i;
+
+    for(i = 0; i < ctx->count; i++)
+        if(ctx->id[i] == id)
+            return i;
+
+    return ctx->count;
+}
+
+// open a slot at the RM position of a new service, equal periods keep arrival order so
+// existing R above stay valid
+static U32_T admission_open(admission_ctx_t *ctx, U32_T period, U32_T wcet, U32_T deadline) {
+    U32_T pos;
+
+    for(pos = 0; pos < ctx->count; pos++)
+    {
+        if(period < ctx->period[pos] ||
+           (period == ctx->period[pos] && deadline < ctx->deadline[pos]))
+            break;
+    }
+
+    admission_shift(ctx, pos, TRUE);
+    ctx->count++;
+    ctx->period[pos]   = period;
+    ctx->wcet[pos]     = wcet;
+    ctx->deadline[pos] = deadline;
+
+    return pos;
+}
+
+// lower bound on R(i) once a higher priority service (period, wcet) joins, the newcomer
+// lands at least ceil(R'/T) >= max(1, ceil(R/T)) jobs inside the new response window
+static inline U64_T admission_grown(U32_T r, U32_T period, U32_T wcet) {
+    U64_T jobs = r / period + ((r % period) != 0);
+
+    return (U64_T)r + ((jobs > 0) ? jobs : 1) * wcet;
+}
+
+// warm started fixed points of services [from, to) into trial[] from their cached R,
+// returns the first service that misses or to
+static U32_T admission_suffix(admission_ctx_t *ctx, U32_T from, U32_T to) {
+    U32_T i, an, start;
+
+    an = (from > 0) ? ctx->resp[from - 1] : 0;
+    for(i = from; i < to; i++)
+    {
+        // a cached R past T is the worst job of a busy window, not a bound on the first job
+        start = an + ctx->wcet[i];
+        if(ctx->resp[i] > start && ctx->resp[i] <= ctx->period[i])
+            start = ctx->resp[i];
+
+        an = response_time_service(i, ctx->period, ctx->wcet, ctx->deadline, start);
+        if(an > ctx->deadline[i])
+            return i;
+        ctx->trial[i] = an;
+    }
+
+    return to;
+}
+
+int admission_add(admission_ctx_t *ctx, U32_T period, U32_T wcet, U32_T deadline, U32_T *id) {
+    U32_T pos, from, i;
+    U64_T grown;
+
+    if(ctx->count == ctx->capacity)
+        return ADMISSION_FULL;
+
+    pos = admission_open(ctx, period, wcet, deadline);
+
+    // the cached R below, exact or lower bounds on the worst job, only grow, and every job of
+    // a busy window takes at least the newcomer jobs admission_grown counts, so anything that
+    // then overshoots D rejects without a single fixed point iteration
+    for(i = pos + 1; i < ctx->count; i++)
+        if(ctx->wcet[i] != 0 && admission_grown(ctx->resp[i], period, wcet) > ctx->deadline[i])
+            goto reject;
+
+    // services above pos never see the newcomer, only the placed ones among them need a pass
+    from = (ctx->stale < pos) ? ctx->stale : pos;
+    if(admission_suffix(ctx, from, pos) != pos)
+        goto reject;
+
+    ctx->trial[pos] = response_time_service(pos, ctx->period, ctx->wcet, ctx->deadline,
+                                            ((pos > 0) ? ctx->resp[pos - 1] : 0) + wcet);
+    if(ctx->trial[pos] > deadline)
+        goto reject;
+
+    // every fixed point below is independent given a lower bound to start from, and the
+    // lowest priorities are the likeliest to miss, so walk up from the bottom. Only a first
+    // job's R grows into one, past T it is a busy window's worst and the start is C
+    for(i = ctx->count - 1; i > pos; i--)
+    {
+        grown = (ctx->resp[i] <= ctx->period[i]) ? admission_grown(ctx->resp[i], period, wcet)
+                                                 : ctx->wcet[i];
+        ctx->trial[i] = response_time_service(i, ctx->period, ctx->wcet, ctx->deadline,
+                                              (U32_T)grown);
+        if(ctx->trial[i] > ctx->deadline[i])
+            goto reject;
+    }
+
+    memcpy(ctx->resp + from, ctx->trial + from, sizeof(U32_T) * (ctx->count - from));
+    ctx->stale = ctx->count;
+    ctx->id[pos] = ctx->next_id++;
+    ctx->utilization += (double)wcet / (double)period;
+
+    if(id != NULL)
+        *id = ctx->id[pos];
+
+    return TRUE;
+
+reject:
+    admission_shift(ctx, pos, FALSE);
+    ctx->count--;
+    return FALSE;
+}
+
+int admission_place(admission_ctx_t *ctx, U32_T period, U32_T wcet, U32_T deadline, U32_T *id) {
+    U32_T pos;
+
+    if(ctx->count == ctx->capacity)
+        return ADMISSION_FULL;
+
+    pos = admission_open(ctx, period, wcet, deadline);
+
+    // inserting only ever grows the R below, so the old cached values stay lower bounds
+    ctx->resp[pos] = 0;
+    if(ctx->stale >= pos)
+        ctx->stale = pos;
+    ctx->id[pos] = ctx->next_id++;
+    ctx->utilization += (double)wcet / (double)period;
+
+    if(id != NULL)
+        *id = ctx->id[pos];
+
+    return TRUE;
+}
+
+int admission_refresh(admission_ctx_t *ctx) {
+    U32_T from = ctx->stale, miss;
+
+    if(from == ctx->count)
+        return TRUE;
+
+    miss = admission_suffix(ctx, from, ctx->count);
+    memcpy(ctx->resp + from, ctx->trial + from, sizeof(U32_T) * (miss - from));
+    ctx->stale = miss;
+
+    return (miss == ctx->count) ? TRUE : FALSE;
+}
+
+int admission_remove(admission_ctx_t *ctx, U32_T id) {
+    U32_T pos = admission_find(ctx, id);
+    U32_T i, an, start;
+
+    if(pos == ctx->count)
+        return FALSE;
+
+    // the cutoff below needs exact R, a placed set that turned out infeasible is left stale
+    // with no warm start, since the old lower bounds now overshoot
+    if(admission_refresh(ctx) != TRUE)
+    {
+        ctx->utilization -= (double)ctx->wcet[pos] / (double)ctx->period[pos];
+        admission_shift(ctx, pos, FALSE);
+        ctx->count--;
+        if(ctx->stale > pos)
+            ctx->stale = pos;
+        memset(ctx->resp + ctx->stale, 0, sizeof(U32_T) * (ctx->count - ctx->stale));
+        return TRUE;
+    }
+
+    ctx->utilization -= (double)ctx->wcet[pos] / (double)ctx->period[pos];
+    admission_shift(ctx, pos, FALSE);
+    ctx->count--;
+    ctx->stale = ctx->count;
+
+    if(ctx->count == 0)
+        ctx->utilization = 0.0;
+
+    an = (pos > 0) ? ctx->resp[pos - 1] : 0;
+    for(i = pos; i < ctx->count; i++)
+    {
+        start = an + ctx->wcet[i];
+
+        // the cached R can only shrink, use it as the cutoff in place of the deadline
+        if(start < ctx->resp[i])
+            an = response_time_service(i, ctx->period, ctx->wcet, ctx->resp, start);
+        else
+            an = ctx->resp[i];
+
+        ctx->resp[i] = an;
+    }
+
+    return TRUE;
+}
+
+int admission_response(admission_ctx_t *ctx, U32_T id, U32_T *resp) {
+    U32_T pos = admission_find(ctx, id);
+
+    if(pos == ctx->count)
+        return FALSE;
+
+    if(pos >= ctx->stale)
+        admission_refresh(ctx);
+
+    *resp = ctx->resp[pos];
+    return TRUE;
+}
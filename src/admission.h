@@ -0,0 +1,107 @@
+/**
+ *  @name   admission
+ *  @brief  incremental RM admission control context caching per-service response times
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include "feasibility.h"
+
+#define ADMISSION_FULL      (-1)
+
+/**
+ *  Services are kept in RM priority order (shorter period first, ties broken by deadline,
+ *  then by arrival) in parallel arrays the kernels can take directly. resp[0..stale) holds
+ *  the exact response time of those services, resp[stale..count) only lower bounds left by
+ *  admission_place. stale == count unless services were placed without analysis.
+*/
+typedef struct {
+    U32_T   count;
+    U32_T   capacity;
+    U32_T   next_id;
+    U32_T   stale;
+    double  utilization;
+    U32_T   *id;
+    U32_T   *period;
+    U32_T   *wcet;
+    U32_T   *deadline;
+    U32_T   *resp;
+    U32_T   *trial;
+} admission_ctx_t;
+
+/**
+ *  @return 0 on success, -1 if the arrays could not be allocated
+*/
+int admission_init(admission_ctx_t *ctx, U32_T capacity);
+void admission_destroy(admission_ctx_t *ctx);
+
+/**
+ *  @brief  grow the context to hold at least capacity services, the admitted set is kept
+ *
+ *  @return 0 on success, -1 if the arrays could not be grown, the context is then unchanged
+*/
+int admission_reserve(admission_ctx_t *ctx, U32_T capacity);
+
+/**
+ *  @brief  retire every service at once, the arrays are kept for reuse
+*/
+void admission_clear(admission_ctx_t *ctx);
+
+/**
+ *  @brief  admit one service if the set stays feasible
+ *
+ *  Services above the new one keep their cached R. The new service warm starts from the
+ *  R of the service just above it and every service below warm starts from the larger of
+ *  its cached R and its predecessor's new R plus its own C, both lower bounds. A cached R
+ *  past T is the worst job of a D > T busy window and no bound on the first job, so such a
+ *  service starts from C instead. The first deadline miss rejects and leaves the context
+ *  untouched. Stale services are re-analyzed
+ *  along the way, so an accepted add always leaves every cached R exact.
+ *
+ *  @param  id  handle for admission_remove, written only when the service is admitted
+ *
+ *  @return TRUE if admitted, FALSE if it would make the set infeasible, ADMISSION_FULL
+*/
+int admission_add(admission_ctx_t *ctx, U32_T period, U32_T wcet, U32_T deadline, U32_T *id);
+
+/**
+ *  @brief  insert a service without running the analysis
+ *
+ *  For callers that already proved the grown set feasible, e.g. with a utilization bound.
+ *  The cached R from the insertion point down become lower bounds, refreshed lazily by the
+ *  next admission_add, admission_remove, admission_response or admission_refresh.
+ *
+ *  @return TRUE, or ADMISSION_FULL
+*/
+int admission_place(admission_ctx_t *ctx, U32_T period, U32_T wcet, U32_T deadline, U32_T *id);
+
+/**
+ *  @brief  bring every stale cached R back to its exact value
+ *
+ *  @return TRUE if every service meets its deadline, FALSE if a placed service misses. The
+ *          context is left stale from the missing service down in that case.
+*/
+int admission_refresh(admission_ctx_t *ctx);
+
+/**
+ *  @brief  retire a service, never affects feasibility
+ *
+ *  Services below it are re-analyzed with their cached R as an upper bound, so a service
+ *  whose warm start already reaches the cached value costs no iterations at all.
+ *
+ *  @return TRUE if the id was found and removed, FALSE otherwise
+*/
+int admission_remove(admission_ctx_t *ctx, U32_T id);
+
+/**
+ *  @brief  current response time of an admitted service
+ *
+ *  @return TRUE and writes resp if the id is admitted, FALSE otherwise
+*/
+int admission_response(admission_ctx_t *ctx, U32_T id, U32_T *resp);
+
+#endif
@@ -0,0 +1,229 @@
+/**
+ *  @name   batch
+ *  @brief  structure-of-arrays batch entry point running all feasibility tests over many task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "batch.h"
+#include "cache.h"
+#include "edf.h"
+#include "screen.h"
+#include "small.h"
+
+// global and partitioned verdicts of one set, all off the same columns
+static int multi_set(feas_workspace_t *ws, const batch_config_t *config, U32_T n,
+                     const U32_T period[], const U32_T wcet[], const U32_T deadline[],
+                     const U32_T order[], feasibility_result_t *result) {
+    partition_t *part;
+    int placed;
+
+    result->multicore = (unsigned char)config->multicore;
+
+    if(config->multicore & BATCH_GLOBAL)
+    {
+        if(global_table_build(&ws->table, n, period, wcet, deadline, config->numCores) != 0)
+            return -1;
+        result->gfb       = (unsigned char)global_edf_gfb(&ws->table);
+        result->bcl       = (unsigned char)global_edf_bcl(&ws->table);
+        result->global_fp = (unsigned char)global_fp_rta(&ws->table, order);
+    }
+
+    if(config->multicore & BATCH_PARTITIONED)
+    {
+        if((part = workspace_partition(ws, config->numCores)) == NULL)
+            return -1;
+
+        placed = partition_assign(part, n, period, wcet, deadline, config->fit, ws->coreOf);
+        if(placed < 0)
+            return -1;
+        result->partitioned = (placed == (int)n) ? TRUE : FALSE;
+    }
+
+    return 0;
+}
+
+// the unrolled small set kernel is exact only while no deadline passes its period
+static int is_constrained(U32_T n, const U32_T period[], const U32_T deadline[]) {
+    U32_T i;
+
+    for(i = 0; i < n; i++)
+        if(deadline[i] > period[i])
+            return FALSE;
+
+    return TRUE;
+}
+
+// the LUB and hyperbolic bounds only speak for rate monotonic priorities, NULL is index order
+static int is_rate_monotonic(U32_T n, const U32_T period[], const U32_T order[]) {
+    U32_T k;
+
+    for(k = 1; k < n; k++)
+        if(order == NULL ? period[k] < period[k - 1] : period[order[k]] < period[order[k - 1]])
+            return FALSE;
+
+    return TRUE;
+}
+
+int feasibility_batch_range_ws(const taskset_batch_t *batch, const batch_config_t *config,
+                               feas_workspace_t *ws, U32_T first, U32_T last,
+                               feasibility_result_t results[]) {
+    U32_T scratch[2 * SCHED_POINT_STACK];
+    U32_T s, base, n;
+    U32_T *order;
+    const U32_T *period, *wcet, *deadline;
+    int priority = (config != NULL) ? config->priority : PRIO_GIVEN;
+    int multicore = (config != NULL && config->numCores > 0) ? config->multicore : 0;
+    U32_T *resp = NULL, *respBase = (config != NULL) ? config->resp : NULL;
+    feas_cache_t *cache = (config != NULL) ? config->cache : NULL;
+    signed char cachedCompletion, cachedSchedPoint;
+    cache_key_t key;
+    int cascade = (config != NULL) ? config->cascade : FALSE;
+    int completion = FALSE, constrained, memo;
+    int rc = 0;
+
+    screen_batch_range(batch, first, last, results);
+
+    for(s = first; s < last; s++)
+    {
+        base     = batch->offset[s];
+        n        = batch->offset[s + 1] - base;
+        period   = batch->period + base;
+        wcet     = batch->wcet + base;
+        deadline = batch->deadline + base;
+
+        // the permutation and the placement column only grow, for the largest set seen
+        if((priority != PRIO_GIVEN || (multicore & BATCH_PARTITIONED)) &&
+           workspace_reserve(ws, n) != 0)
+        {
+            rc = -1;
+            break;
+        }
+        order = (priority == PRIO_GIVEN) ? NULL : ws->order;
+        if(order != NULL)
+            priority_order(n, period, deadline, priority, order);
+
+        results[s].multicore = 0;
+
+        if(multicore && multi_set(ws, config, n, period, wcet, deadline, order, &results[s]) != 0)
+        {
+            rc = -1;
+            break;
+        }
+
+        // U > 1 fails any priority and any deadlines, the bound accept needs the order to be RM
+        if(results[s].screen == SCREEN_FEASIBLE && priority != PRIO_RM &&
+           !is_rate_monotonic(n, period, order))
+        {
+            results[s].screen = SCREEN_UNKNOWN;
+            results[s].stage  = BATCH_STAGE_RTA;
+        }
+
+        if(respBase != NULL)
+        {
+            resp = respBase + (base - batch->offset[0]);
+            memset(resp, 0, sizeof(U32_T) * n);
+        }
+
+        // a screened set without response times is cheaper to redo than to look up, and the
+        // multicore verdicts are not memoized
+        memo = (cache != NULL && !multicore && (resp != NULL || results[s].screen == SCREEN_UNKNOWN));
+        if(memo)
+        {
+            cache_key(&key, n, period, wcet, deadline, order);
+            if(cache_lookup(cache, &key, order, &cachedCompletion, &cachedSchedPoint,
+                            &results[s].edf, resp))
+            {
+                results[s].completion  = (unsigned char)cachedCompletion;
+                results[s].sched_point = (unsigned char)cachedSchedPoint;
+                results[s].stage       = BATCH_STAGE_MEMO;
+                continue;
+            }
+        }
+
+        // response times are wanted for every set, so the completion test cannot be screened
+        if(resp != NULL)
+        {
+            if(order == NULL)
+                completion = response_time_analysis(n, period, wcet, deadline, resp);
+            else
+                completion = response_time_analysis_order(n, period, wcet, deadline, order, resp);
+        }
+
+        // a screened verdict holds for EDF too, U <= LUB < 1 or U > 1
+        if(results[s].screen != SCREEN_UNKNOWN)
+        {
+            results[s].completion  = (results[s].screen == SCREEN_FEASIBLE) ? TRUE : FALSE;
+            results[s].sched_point = results[s].completion;
+            results[s].edf        = results[s].completion;
+        }
+        else
+        {
+            constrained = is_constrained(n, period, deadline);
+
+            if(resp == NULL && n <= SMALL_MAX_SERVICES && constrained)
+            {
+                // both exact tests give the same verdict, one straight line pass decides them
+                results[s].completion  = (unsigned char)small_feasibility(n, period, wcet,
+                                                                          deadline, order);
+                results[s].sched_point = results[s].completion;
+            }
+            else
+            {
+                if(resp == NULL)
+                    completion = (order == NULL)
+                        ? response_time_analysis(n, period, wcet, deadline, NULL)
+                        : response_time_analysis_order(n, period, wcet, deadline, order, NULL);
+                results[s].completion = (unsigned char)completion;
+
+                // a miss fails the scheduling point test too, a pass only carries over for D <= T
+                if(cascade && (!completion || constrained))
+                    results[s].sched_point = results[s].completion;
+                else
+                    results[s].sched_point = (order == NULL)
+                        ? scheduling_point_feasibility(n, period, wcet, deadline)
+                        : scheduling_point_analysis_order(n, period, wcet, deadline, order,
+                                                          scratch, SCHED_POINT_STACK, NULL);
+            }
+
+            results[s].stage = (!results[s].completion || constrained) ? BATCH_STAGE_RTA
+                                                                       : BATCH_STAGE_SP;
+
+            // EDF is optimal on one core, so a set fixed priorities can schedule it can too
+            if(cascade && results[s].completion && constrained)
+                results[s].edf = TRUE;
+            else
+                results[s].edf = (signed char)edf_demand_feasibility(n, period, wcet, deadline);
+        }
+
+        if(memo)
+            cache_insert(cache, &key, order, (signed char)results[s].completion,
+                         (signed char)results[s].sched_point, results[s].edf, resp);
+    }
+
+    return rc;
+}
+
+int feasibility_batch_range(const taskset_batch_t *batch, const batch_config_t *config,
+                            U32_T first, U32_T last, feasibility_result_t results[]) {
+    feas_workspace_t local;
+    int rc;
+
+    if(config != NULL && config->numWorkspaces > 0)
+        return feasibility_batch_range_ws(batch, config, &config->workspace[0], first, last,
+                                          results);
+
+    workspace_init(&local);
+    rc = feasibility_batch_range_ws(batch, config, &local, first, last, results);
+    workspace_free(&local);
+
+    return rc;
+}
+
+void feasibility_batch(const taskset_batch_t *batch, feasibility_result_t results[]) {
+    feasibility_batch_range(batch, NULL, 0, batch->numSets, results);
+}
@@ -0,0 +1,128 @@
+/**
+ *  @name   batch
+ *  @brief  structure-of-arrays batch entry point running all feasibility tests over many task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "cache.h"
+#include "feasibility.h"
+#include "workspace.h"
+
+/**
+ *  Task sets are packed back to back in the period/wcet/deadline columns.
+ *  Set s owns tasks [offset[s], offset[s+1]), so offset has numSets+1 entries
+ *  and offset[numSets] is the total number of tasks in the batch.
+*/
+typedef struct {
+    U32_T           numSets;
+    const U32_T     *offset;
+    const U32_T     *period;
+    const U32_T     *wcet;
+    const U32_T     *deadline;
+} taskset_batch_t;
+
+typedef struct {
+    double          utilization;
+    double          lub;
+    double          hyperbolic;
+    unsigned char   screen;
+    unsigned char   rm_lub;
+    unsigned char   completion;
+    unsigned char   sched_point;
+    signed char     edf;
+    unsigned char   multicore;      // BATCH_* flags of the multicore verdicts below that are set
+    unsigned char   gfb;            // global EDF, GFB density bound
+    unsigned char   bcl;            // global EDF, BCL window test
+    unsigned char   global_fp;      // global fixed priority response time analysis
+    unsigned char   partitioned;    // every service packed onto a core under partitioned RM
+    unsigned char   stage;          // BATCH_STAGE_* that settled the fixed priority verdicts
+} feasibility_result_t;
+
+// cascade stages from cheapest to dearest, see feasibility_batch_range
+#define BATCH_STAGE_UTIL    0       // U > 1, rejected by the screen
+#define BATCH_STAGE_LUB     1       // U <= LUB, accepted by the screen
+#define BATCH_STAGE_HB      2       // prod(U(i) + 1) <= 2, accepted by the screen
+#define BATCH_STAGE_RTA     3       // completion test, or the small set kernel
+#define BATCH_STAGE_SP      4       // scheduling point, RTA passed with some D > T
+#define BATCH_STAGE_MEMO    5       // verdicts taken from config->cache
+#define BATCH_STAGE_COUNT   6
+
+// multicore analyses a batch can run next to the single core tests
+#define BATCH_GLOBAL        0x1     // GFB, BCL and global fixed priority RTA, see global.h
+#define BATCH_PARTITIONED   0x2     // bin-packing onto the cores, see partition.h
+
+/**
+ *  Analysis options shared by every set of a batch, a NULL config means all defaults.
+*/
+typedef struct {
+    int             priority;   // PRIO_GIVEN, PRIO_RM or PRIO_DM (see feasibility.h)
+    U32_T           numCores;   // processors for the multicore analyses, 0 skips them
+    int             multicore;  // BATCH_GLOBAL and/or BATCH_PARTITIONED
+    int             fit;        // PART_* heuristic for BATCH_PARTITIONED
+    U32_T           *resp;      // optional response times, see feasibility_batch_range
+    feas_cache_t    *cache;     // optional memo of single core verdicts, see cache.h
+    feas_workspace_t *workspace; // optional per worker scratch, see feasibility_batch_range
+    U32_T           numWorkspaces;
+    int             cascade;    // stop at the first stage that settles a set, see below
+} batch_config_t;
+
+/**
+ *  @brief  run RM LUB, completion time, scheduling point and EDF demand on every set of the batch
+ *
+ *  Sets are screened with the LUB and hyperbolic bounds first (see screen.h), the exact
+ *  tests only run on the sets the screen cannot decide.
+ *
+ *  @param  results one entry per set, results[s] describes set s
+*/
+void feasibility_batch(const taskset_batch_t *batch, feasibility_result_t results[]);
+
+/**
+ *  @brief  feasibility_batch under an explicit config, restricted to sets [first, last)
+ *
+ *  Under PRIO_RM or PRIO_DM each set is indexed once into priority order and the completion
+ *  and scheduling point tests walk that permutation, the batch columns are never reordered.
+ *  A screened feasible verdict is only kept when the resulting order is rate monotonic.
+ *  With numCores set, the global and partitioned verdicts of each set come from the same
+ *  pass over its columns, global fixed priority following the same priority order.
+ *
+ *  With config->resp set, the completion test runs on every set, screened or not, and writes
+ *  the response time of task k of set s to resp[offset[s] - offset[0] + k]. Services below
+ *  the first miss, which the test never reaches, and C = 0 services get 0.
+ *
+ *  Every set passes U > 1, LUB, hyperbolic, RTA and scheduling point in that order and
+ *  results[s].stage names the first one that settles its fixed priority verdicts. RTA
+ *  settles a miss, which fails the scheduling point test as well, and a pass when no
+ *  deadline exceeds its period, where the two tests agree. With config->cascade set the
+ *  later stages are skipped. Scheduling point then only runs after an RTA pass with some
+ *  D > T. EDF demand is skipped once RTA has a D <= T set feasible, since EDF schedules
+ *  any set a fixed priority order can. Verdicts are the same either way, only the work
+ *  differs.
+ *
+ *  With config->cache set and no multicore analyses, every set that reaches the exact tests
+ *  is looked up by its canonical form first and memoized after, see cache.h.
+ *
+ *  Per set scratch comes from config->workspace[0] when there is one, and from a workspace
+ *  set up and torn down around the call otherwise. Callers that run many ranges should
+ *  keep workspaces in the config, warm ones make no heap allocations.
+ *
+ *  @return 0, or -1 if the per-set working storage could not be allocated, the remaining
+ *          results of the range are then left unwritten
+*/
+int feasibility_batch_range(const taskset_batch_t *batch, const batch_config_t *config,
+                            U32_T first, U32_T last, feasibility_result_t results[]);
+
+/**
+ *  @brief  feasibility_batch_range with the per set scratch taken from ws
+ *
+ *  ws is only touched by this call, so concurrent ranges each need their own.
+*/
+int feasibility_batch_range_ws(const taskset_batch_t *batch, const batch_config_t *config,
+                               feas_workspace_t *ws, U32_T first, U32_T last,
+                               feasibility_result_t results[]);
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ *  @name   bench
+ *  @brief  timing harness for the feasibility kernels over random UUniFast task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Bini, Enrico, and Giorgio C. Buttazzo. "Measuring the performance of schedulability tests."
+ *          Real-Time Systems 30.1 (2005): 129-154.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "batch.h"
+#include "blocking.h"
+#include "feasibility.h"
+#include "generator.h"
+#include "partition.h"
+
+typedef struct {
+    U32_T   numSets;
+    U32_T   numServices;
+    double  utilization;
+    double  periodMin;
+    double  periodRatio;
+    U32_T   repeats;
+    U32_T   cores;
+    U32_T   resources;
+    double  jitter;
+    U32_T   switchCost;
+    unsigned long long seed;
+} bench_config_t;
+
+typedef struct {
+    const char  *name;
+    double      nsPerSet;
+    U32_T       accepted;
+    double      iterPerTask;
+} bench_row_t;
+
+static unsigned long long rng_state;
+
+// xorshift64*, plenty for workload generation and identical on every platform
+static double rng_uniform(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (double)((rng_state * 2685821657736338717ull) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// each service locks each resource with probability 1/2 for up to a quarter of its WCET,
+// and is released up to jitter * T late
+static void generate_model(const bench_config_t *cfg, const U32_T period[], const U32_T wcet[],
+                           U32_T section[], U32_T jitter[]) {
+    U32_T i, r;
+
+    for(i = 0; i < cfg->numServices; i++)
+    {
+        for(r = 0; r < cfg->resources; r++)
+            section[i * cfg->resources + r] = (rng_uniform() < 0.5)
+                ? (U32_T)(rng_uniform() * (double)wcet[i] / 4.0) : 0;
+        jitter[i] = (U32_T)(rng_uniform() * cfg->jitter * (double)period[i]);
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-s sets] [-n tasks] [-u utilization] [-m period_min] [-r period_ratio]\n"
+                    "          [-R repeats] [-S seed] [-M cores] [-L resources] [-J jitter] [-W switch_cost]\n"
+                    "\t-M\talso time partitioning every set onto that many cores, -u is then the total\n"
+                    "\t-L\tshared resources for the blocking RTA row (default 2)\n"
+                    "\t-J\trelease jitter of each service, up to that fraction of T (default 0)\n"
+                    "\t-W\tcontext switch cost charged twice per job (default 0)\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    bench_config_t cfg = { 100000, 8, 0.85, 10.0, 1000.0, 3, 0, 2, 0.0, 0, 1 };
+    static const char *fits[] = { "partition_ff", "partition_bf", "partition_wf" };
+    bench_row_t rows[9];
+    gen_config_t genConfig;
+    generator_t gen;
+    taskset_arena_t arena, scratch;
+    partition_t part;
+    blocking_table_t table;
+    blocking_model_t model;
+    U32_T *coreOf = NULL, *section, *jitter;
+    U32_T numRows = 6;
+    taskset_batch_t batch;
+    feasibility_result_t *results;
+    U32_T *period, *wcet, *deadline;
+    U32_T s, r, k, n, base, accepted, iterations;
+    double t0, best;
+    int opt;
+
+    while((opt = getopt(argc, argv, "s:n:u:m:r:R:S:M:L:J:W:h")) != -1)
+    {
+        switch(opt)
+        {
+            case 's': cfg.numSets     = (U32_T)strtoul(optarg, NULL, 10); break;
+            case 'n': cfg.numServices = (U32_T)strtoul(optarg, NULL, 10); break;
+            case 'u': cfg.utilization = strtod(optarg, NULL); break;
+            case 'm': cfg.periodMin   = strtod(optarg, NULL); break;
+            case 'r': cfg.periodRatio = strtod(optarg, NULL); break;
+            case 'R': cfg.repeats     = (U32_T)strtoul(optarg, NULL, 10); break;
+            case 'S': cfg.seed        = strtoull(optarg, NULL, 10); break;
+            case 'M': cfg.cores       = (U32_T)strtoul(optarg, NULL, 10); break;
+            case 'L': cfg.resources   = (U32_T)strtoul(optarg, NULL, 10); break;
+            case 'J': cfg.jitter      = strtod(optarg, NULL); break;
+            case 'W': cfg.switchCost  = (U32_T)strtoul(optarg, NULL, 10); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(cfg.numSets == 0 || cfg.numServices == 0 || cfg.repeats == 0 || cfg.periodMin < 1.0 || cfg.periodRatio < 1.0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // UUniFast utilizations on log-uniform periods, emitted in RM order with D = T
+    gen_defaults(&genConfig);
+    genConfig.numSets     = cfg.numSets;
+    genConfig.minServices = cfg.numServices;
+    genConfig.maxServices = cfg.numServices;
+    genConfig.utilization = cfg.utilization;
+    genConfig.periodMin   = cfg.periodMin;
+    genConfig.periodMax   = cfg.periodMin * cfg.periodRatio;
+    genConfig.seed        = cfg.seed;
+    if(gen_init(&gen, &genConfig) != 0)
+    {
+        fprintf(stderr, "%s\n", gen.error);
+        return 1;
+    }
+
+    n = cfg.numServices;
+    taskset_arena_init(&arena);
+    taskset_arena_init(&scratch);
+    results  = malloc(sizeof(feasibility_result_t) * cfg.numSets);
+    section  = malloc(sizeof(U32_T) * cfg.numSets * n * (cfg.resources > 0 ? cfg.resources : 1));
+    jitter   = malloc(sizeof(U32_T) * cfg.numSets * n);
+    if(!results || !section || !jitter || gen_fill(&gen, 0, cfg.numSets, &arena, NULL, 1) != 0)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    period   = arena.period;
+    wcet     = arena.wcet;
+    deadline = arena.deadline;
+
+    rng_state = cfg.seed ? cfg.seed : 1;
+    // drawn after every set, so a seed gives the same sets whatever the model options
+    for(s = 0; s < cfg.numSets; s++)
+        generate_model(&cfg, period + s * n, wcet + s * n, section + s * n * cfg.resources,
+                       jitter + s * n);
+
+    taskset_arena_batch(&arena, &batch);
+
+    if(cfg.cores > 0)
+    {
+        coreOf = malloc(sizeof(U32_T) * n);
+        if(coreOf == NULL || partition_init(&part, cfg.cores) != 0)
+        {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        numRows = 9;
+    }
+
+    blocking_table_init(&table);
+    model.numResources = cfg.resources;
+    model.switchCost   = cfg.switchCost;
+
+    // every kernel takes the best of the repeats, iteration counts come from the last pass
+    for(k = 0; k < numRows; k++)
+    {
+        best = 0.0;
+        for(r = 0; r < cfg.repeats; r++)
+        {
+            accepted = 0;
+            iterations = 0;
+            t0 = now_ns();
+
+            if(k == 3)
+            {
+                feasibility_batch(&batch, results);
+                for(s = 0; s < cfg.numSets; s++)
+                    accepted += results[s].completion;
+            }
+            else if(k == 4)
+            {
+                // the table build is part of the cost, it runs once per set
+                for(s = 0, base = 0; s < cfg.numSets; s++, base += n)
+                {
+                    model.section = section + base * cfg.resources;
+                    model.jitter  = jitter + base;
+                    if(blocking_table_build(&table, n, period + base, wcet + base, deadline + base,
+                                            NULL, &model) == 0)
+                        accepted += blocking_rta(&table, NULL);
+                }
+            }
+            else if(k == 5)
+            {
+                // the same sets again on one thread, to set against the kernels that consume them
+                if(gen_fill(&gen, 0, cfg.numSets, &scratch, NULL, 1) == 0)
+                    accepted = scratch.numSets;
+            }
+            else if(k > 5)
+            {
+                // a set counts as accepted when every service found a core
+                for(s = 0, base = 0; s < cfg.numSets; s++, base += n)
+                    accepted += (partition_assign(&part, n, period + base, wcet + base, deadline + base,
+                                                  (int)(k - 6), coreOf) == (int)n);
+            }
+            else
+            {
+                for(s = 0, base = 0; s < cfg.numSets; s++, base += n)
+                {
+                    if(k == 0)
+                        accepted += rate_monotonic_least_upper_bound(n, period + base, wcet + base, deadline + base);
+                    else if(k == 1)
+                        accepted += response_time_analysis_count(n, period + base, wcet + base, deadline + base,
+                                                                 NULL, &iterations);
+                    else
+                        accepted += scheduling_point_feasibility(n, period + base, wcet + base, deadline + base);
+                }
+            }
+
+            t0 = now_ns() - t0;
+            if(r == 0 || t0 < best)
+                best = t0;
+        }
+
+        rows[k].nsPerSet    = best / (double)cfg.numSets;
+        rows[k].accepted    = accepted;
+        rows[k].iterPerTask = (double)iterations / ((double)cfg.numSets * (double)n);
+    }
+
+    rows[0].name = "rm_lub";
+    rows[1].name = "completion_time";
+    rows[2].name = "scheduling_point";
+    rows[3].name = "batch";
+    rows[4].name = "blocking_rta";
+    rows[5].name = "generate";
+    for(k = 6; k < numRows; k++)
+        rows[k].name = fits[k - 6];
+
+    printf("%u sets, n=%u, U=%.3f, periods %.0f..%.0f, best of %u, seed %llu\n",
+           cfg.numSets, n, cfg.utilization, cfg.periodMin, cfg.periodMin * cfg.periodRatio,
+           cfg.repeats, cfg.seed);
+    printf("%-18s %12s %14s %10s %12s\n", "kernel", "ns/set", "sets/s", "accepted", "iter/task");
+    for(k = 0; k < numRows; k++)
+    {
+        printf("%-18s %12.1f %14.0f %10u", rows[k].name, rows[k].nsPerSet,
+               1e9 / rows[k].nsPerSet, rows[k].accepted);
+        if(k == 1)
+            printf(" %12.3f\n", rows[k].iterPerTask);
+        else
+            printf(" %12s\n", "-");
+    }
+
+    if(cfg.cores > 0)
+    {
+        partition_destroy(&part);
+        free(coreOf);
+    }
+
+    taskset_arena_free(&arena);
+    taskset_arena_free(&scratch);
+    gen_free(&gen);
+    free(results);
+    free(section);
+    free(jitter);
+    blocking_table_free(&table);
+    return 0;
+}
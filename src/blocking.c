@@ -0,0 +1,242 @@
+/**
+ *  @name   blocking
+ *  @brief  fixed priority response time analysis with shared resource blocking, release jitter
+ *          and context switch cost
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "blocking.h"
+#include "exact.h"
+
+void blocking_table_init(blocking_table_t *table) {
+    memset(table, 0, sizeof(*table));
+}
+
+void blocking_table_free(blocking_table_t *table) {
+    free(table->ceiling);
+    free(table->held);
+    free(table->blocking);
+    free(table->period);
+    free(table->jitter);
+    free(table->cost);
+    memset(table, 0, sizeof(*table));
+}
+
+// grow one column, the old one is kept if that fails
+static int grow(void **col, size_t size) {
+    void *p = realloc(*col, size);
+
+    if(p == NULL)
+        return -1;
+
+    *col = p;
+    return 0;
+}
+
+static int blocking_reserve(blocking_table_t *table, U32_T count, U32_T resources) {
+    if(count > table->capacity)
+    {
+        if(grow((void **)&table->blocking, sizeof(U32_T) * count) != 0 ||
+           grow((void **)&table->period, sizeof(U32_T) * count) != 0 ||
+           grow((void **)&table->jitter, sizeof(U32_T) * count) != 0 ||
+           grow((void **)&table->cost, sizeof(U64_T) * count) != 0)
+            return -1;
+        table->capacity = count;
+    }
+
+    if(resources > table->resCapacity)
+    {
+        if(grow((void **)&table->ceiling, sizeof(U32_T) * resources) != 0 ||
+           grow((void **)&table->held, sizeof(U32_T) * resources) != 0)
+            return -1;
+        table->resCapacity = resources;
+    }
+
+    return 0;
+}
+
+int blocking_table_build(blocking_table_t *table, U32_T numServices, const U32_T period[],
+                         const U32_T wcet[], const U32_T deadline[], const U32_T order[],
+                         const blocking_model_t *model) {
+    U32_T m = (model != NULL && model->section != NULL) ? model->numResources : 0;
+    U64_T overhead = (model != NULL) ? 2 * (U64_T)model->switchCost : 0;
+    const U32_T *row;
+    U32_T i, oi, r, b;
+
+    if(blocking_reserve(table, numServices, m) != 0)
+        return -1;
+
+    table->numServices = numServices;
+    table->order       = order;
+    table->deadline    = deadline;
+
+    // the fixed points walk the levels in order, so they get their own contiguous columns
+    for(i = 0; i < numServices; i++)
+    {
+        oi = (order != NULL) ? order[i] : i;
+        table->period[i] = period[oi];
+        table->jitter[i] = (model != NULL && model->jitter != NULL) ? model->jitter[oi] : 0;
+        table->cost[i]   = (wcet[oi] > 0) ? wcet[oi] + overhead : 0;
+    }
+
+    if(m == 0)
+    {
+        for(i = 0; i < numServices; i++)
+            table->blocking[i] = 0;
+        return 0;
+    }
+
+    // a ceiling is the highest priority level locking the resource, numServices if none does
+    for(r = 0; r < m; r++)
+    {
+        table->ceiling[r] = numServices;
+        table->held[r]    = 0;
+    }
+    for(i = numServices; i-- > 0;)
+    {
+        row = model->section + (size_t)((order != NULL) ? order[i] : i) * m;
+        for(r = 0; r < m; r++)
+            if(row[r] > 0)
+                table->ceiling[r] = i;
+    }
+
+    // bottom up, held[r] is the longest section on r of any level below i when B(i) is taken
+    for(i = numServices; i-- > 0;)
+    {
+        oi  = (order != NULL) ? order[i] : i;
+        row = model->section + (size_t)oi * m;
+        b   = 0;
+
+        for(r = 0; r < m; r++)
+        {
+            if(table->ceiling[r] <= i && table->held[r] > b)
+                b = table->held[r];
+            if(row[r] > table->held[r])
+                table->held[r] = row[r];
+        }
+
+        table->blocking[oi] = b;
+    }
+
+    return 0;
+}
+
+// w(q) of job q of level i, the least fixed point of
+// w = (q + 1) C'(i) + B(i) + sum_j<i ceil((w + J(j)) / T(j)) * C'(j) from a start at or below it,
+// or the first iterate past bound
+static U64_T level_fixed_point(const blocking_table_t *table, U32_T i, U32_T oi, U64_T q,
+                               U64_T w, U64_T bound) {
+    U64_T next, own, term, jobs;
+    U32_T j;
+
+    if(__builtin_mul_overflow(q + 1, table->cost[i], &own) ||
+       __builtin_add_overflow(own, (U64_T)table->blocking[oi], &own))
+        return ~0ull;
+
+    while(w <= bound)
+    {
+        next = own;
+
+        for(j = 0; j < i; j++)
+        {
+            jobs = (w + table->jitter[j] + table->period[j] - 1) / table->period[j];
+            if(__builtin_mul_overflow(jobs, table->cost[j], &term) ||
+               __builtin_add_overflow(next, term, &next))
+            {
+                next = ~0ull;
+                break;
+            }
+        }
+
+        if(next == w)
+            break;
+        w = next;
+    }
+
+    return w;
+}
+
+// with the level saturated a blocked or jittered window never closes, so it is not bounded
+static int level_unbounded(const blocking_table_t *table, U32_T i, U32_T oi) {
+    int cmp = exact_cost_compare(i + 1, table->period, table->cost);
+    U32_T j;
+
+    if(cmp > 0)
+        return TRUE;
+    if(cmp < 0)
+        return FALSE;
+    if(table->blocking[oi] != 0)
+        return TRUE;
+
+    for(j = 0; j <= i; j++)
+        if(table->jitter[j] != 0)
+            return TRUE;
+
+    return FALSE;
+}
+
+int blocking_rta(const blocking_table_t *table, U32_T resp[]) {
+    U32_T i, oi;
+    U64_T w, q, release, r, worst, limit, sum = 0;
+
+    for(i = 0; i < table->numServices; i++)
+    {
+        oi   = (table->order != NULL) ? table->order[i] : i;
+        sum += table->cost[i];
+
+        // a job with no work completes the instant it is released
+        if(table->cost[i] == 0)
+        {
+            if(resp != NULL)
+                resp[oi] = 0;
+            continue;
+        }
+
+        // w(q) - q T(i) past limit is a miss, every higher priority service releases at least
+        // one job inside any busy window
+        limit = (table->deadline[oi] >= table->jitter[i]) ? table->deadline[oi] - table->jitter[i] : 0;
+        w     = sum + table->blocking[oi];
+        worst = 0;
+
+        // the level-i busy window, job q is released at q T(i) and completes at w(q) + J(i),
+        // the window closes with the first job done by the next release
+        for(q = 0;; q++)
+        {
+            release = q * table->period[i];
+            w = level_fixed_point(table, i, oi, q, w, release + limit);
+
+            // a window kept open by the previous job has w(q) + J(i) > q T(i)
+            if(__builtin_add_overflow(w, (U64_T)table->jitter[i], &r))
+                r = ~0ull;
+            else
+                r -= release;
+            if(r > worst)
+                worst = r;
+
+            if(r > table->deadline[oi] || r <= table->period[i])
+                break;
+
+            if(q == 0 && level_unbounded(table, i, oi))
+            {
+                worst = ~0ull;
+                break;
+            }
+
+            // w(q) + C'(i) never overshoots w(q + 1)
+            w += table->cost[i];
+        }
+
+        if(resp != NULL)
+            resp[oi] = (worst > 0xFFFFFFFFull) ? 0xFFFFFFFFu : (U32_T)worst;
+
+        if(worst > table->deadline[oi])
+            return FALSE;
+    }
+
+    return TRUE;
+}
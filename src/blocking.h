@@ -0,0 +1,100 @@
+/**
+ *  @name   blocking
+ *  @brief  fixed priority response time analysis with shared resource blocking, release jitter
+ *          and context switch cost
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Sha, Lui, Ragunathan Rajkumar, and John P. Lehoczky. "Priority inheritance protocols: An
+ *          approach to real-time synchronization." IEEE Transactions on Computers 39.9 (1990): 1175-1185.
+ *  @cite   Baker, Theodore P. "Stack-based scheduling of realtime processes." Real-Time Systems 3.1
+ *          (1991): 67-99.
+ *  @cite   Tindell, Ken, Alan Burns, and Andy J. Wellings. "An extendible approach for analyzing fixed
+ *          priority hard real-time tasks." Real-Time Systems 6.2 (1994): 133-151.
+ *
+ *  The response time of the service at level i is R(i) = w(i) + J(i), w(i) the least fixed point of
+ *
+ *      w = C'(i) + B(i) + sum_j<i ceil((w + J(j)) / T(j)) * C'(j)
+ *
+ *  with C' = C + 2 * switchCost for each job with work, one switch in and one out. This
+ *  bounds the cost of each preemption, since every preempting job is one of those jobs.
+ *
+ *  Under the priority ceiling protocol, and under the stack resource policy with preemption
+ *  levels following the priorities, a job is blocked at most once, by a single critical
+ *  section that belongs to a lower priority service and whose resource has a ceiling at or
+ *  above its own priority:
+ *
+ *      B(i) = max { section(j, r) : level(j) > i, ceiling(r) <= i }
+ *
+ *  A first job still running at its next release, J(i) + w(i) > T(i), opens the level-i busy
+ *  window as in response_time_analysis. Job q of the window is the least fixed point of
+ *
+ *      w(q) = (q + 1) C'(i) + B(i) + sum_j<i ceil((w(q) + J(j)) / T(j)) * C'(j)
+ *
+ *  with R(q) = w(q) + J(i) - q T(i), and the window closes at the first R(q) <= T(i). R(i) is
+ *  the worst R(q). A window that would never close, the level utilization over 1, or at 1 with
+ *  any blocking or jitter, is a miss.
+*/
+
+#ifndef BLOCKING_H
+#define BLOCKING_H
+
+#include "feasibility.h"
+
+/**
+ *  Everything the plain C/T model leaves out, NULL members and zeros mean none.
+*/
+typedef struct {
+    U32_T           numResources;
+    const U32_T     *section;       // longest critical section of service i on resource r at
+                                    // [i * numResources + r], 0 if i never locks r
+    const U32_T     *jitter;        // release jitter of each service
+    U32_T           switchCost;     // one context switch, every job is charged two
+} blocking_model_t;
+
+/**
+ *  Ceilings, blocking terms and the per level costs of one set, built once and then read by
+ *  every fixed point. All columns grow to the largest set built and are kept between sets.
+*/
+typedef struct {
+    U32_T           numServices;
+    U32_T           capacity;
+    U32_T           resCapacity;
+    const U32_T     *order;         // NULL for index order
+    const U32_T     *deadline;
+    U32_T           *ceiling;       // per resource, highest priority level locking it
+    U32_T           *held;          // per resource, longest section below the level being built
+    U32_T           *blocking;      // B of each service, indexed like the input
+    U32_T           *period;        // per level from here on
+    U32_T           *jitter;
+    U64_T           *cost;          // C', 0 for a service without work
+} blocking_table_t;
+
+void blocking_table_init(blocking_table_t *table);
+void blocking_table_free(blocking_table_t *table);
+
+/**
+ *  @brief  precompute the resource ceilings, every B(i) and the per level costs, O(n * m)
+ *
+ *  @param  order   level order as priority_order writes it, NULL if the arrays already are
+ *                  highest priority first
+ *  @param  model   may be NULL, which reduces the analysis to response_time_analysis
+ *
+ *  @return 0 on success, -1 if the table could not grow to the set
+*/
+int blocking_table_build(blocking_table_t *table, U32_T numServices, const U32_T period[],
+                         const U32_T wcet[], const U32_T deadline[], const U32_T order[],
+                         const blocking_model_t *model);
+
+/**
+ *  @brief  response time analysis on a built table
+ *
+ *  @param  resp    optional, R(i) including J(i) indexed like the input, saturated at
+ *                  0xFFFFFFFF, services after the first miss are left unwritten
+ *
+ *  @return TRUE if every service meets D(i), FALSE otherwise
+*/
+int blocking_rta(const blocking_table_t *table, U32_T resp[]);
+
+#endif
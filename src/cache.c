@@ -0,0 +1,293 @@
+/**
+ *  @name   cache
+ *  @brief  sequence locked 4 way hash table of canonical task set verdicts
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cache.h"
+
+static const char cacheMagic[8] = { 'F', 'E', 'A', 'S', 'M', 'E', 'M', 'O' };
+
+// service at priority level k, order == NULL means index order
+static inline U32_T at(const U32_T order[], U32_T k) {
+    return (order == NULL) ? k : order[k];
+}
+
+static U32_T gcd32(U32_T a, U32_T b) {
+    U32_T r;
+
+    while(b != 0)
+    {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+// splitmix64 finalizer, every input bit reaches every output bit
+static inline U64_T mix64(U64_T h) {
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+    return h;
+}
+
+void cache_key(cache_key_t *key, U32_T numServices, const U32_T period[], const U32_T wcet[],
+               const U32_T deadline[], const U32_T order[]) {
+    U64_T a = 0x9E3779B97F4A7C15ull ^ numServices, b = 0xC2B2AE3D27D4EB4Full + numServices;
+    U64_T lo, hi;
+    U32_T k, i, g = 0;
+
+    // any common factor of every parameter scales the whole analysis by that factor
+    for(i = 0; i < numServices && g != 1; i++)
+        g = gcd32(gcd32(gcd32(g, period[i]), wcet[i]), deadline[i]);
+    if(g == 0)
+        g = 1;
+
+    for(k = 0; k < numServices; k++)
+    {
+        i  = at(order, k);
+        lo = ((U64_T)(period[i] / g) << 32) | (wcet[i] / g);
+        hi = deadline[i] / g;
+
+        // two independently seeded lanes make the 128 bit fingerprint
+        a = mix64(a ^ lo) + hi;
+        b = mix64(b + hi) ^ (lo * 0xFF51AFD7ED558CCDull);
+    }
+
+    key->key[0]      = mix64(a ^ (b >> 17));
+    key->key[1]      = mix64(b ^ (a << 13));
+    key->scale       = g;
+    key->numServices = numServices;
+}
+
+int cache_init(feas_cache_t *cache, U64_T entries) {
+    U64_T buckets = 1;
+
+    memset(cache, 0, sizeof(*cache));
+
+    while(buckets * CACHE_WAYS < entries)
+        buckets <<= 1;
+
+    cache->slots = calloc(buckets * CACHE_WAYS, sizeof(cache_slot_t));
+    if(cache->slots == NULL)
+    {
+        snprintf(cache->error, sizeof(cache->error), "no memory for %llu cache slots",
+                 buckets * CACHE_WAYS);
+        return -1;
+    }
+    cache->numBuckets = buckets;
+
+    return 0;
+}
+
+void cache_free(feas_cache_t *cache) {
+    free(cache->slots);
+    cache->slots = NULL;
+}
+
+static inline cache_slot_t *cache_bucket(feas_cache_t *cache, const U64_T key[2]) {
+    return cache->slots + (key[0] & (cache->numBuckets - 1)) * CACHE_WAYS;
+}
+
+// consistent copy of a slot, FALSE if it is empty or a writer raced the read
+static inline int slot_read(cache_slot_t *slot, cache_entry_t *entry) {
+    U32_T before = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE), after;
+
+    if(before == 0 || (before & 1))
+        return FALSE;
+
+    memcpy(entry, &slot->entry, sizeof(*entry));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    after = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+
+    return before == after;
+}
+
+int cache_lookup(feas_cache_t *cache, const cache_key_t *key, const U32_T order[],
+                 signed char *completion, signed char *sched_point, signed char *edf,
+                 U32_T resp[]) {
+    cache_slot_t *bucket = cache_bucket(cache, key->key);
+    cache_entry_t entry;
+    U32_T w, k;
+
+    for(w = 0; w < CACHE_WAYS; w++)
+    {
+        if(!slot_read(&bucket[w], &entry))
+            continue;
+        if(entry.key[0] != key->key[0] || entry.key[1] != key->key[1] ||
+           entry.numServices != key->numServices)
+            continue;
+        if(resp != NULL && !entry.hasResp)
+            break;
+
+        *completion  = entry.completion;
+        *sched_point = entry.sched_point;
+        *edf         = entry.edf;
+        for(k = 0; resp != NULL && k < key->numServices; k++)
+            resp[at(order, k)] = entry.resp[k] * key->scale;
+
+        __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+        return TRUE;
+    }
+
+    __atomic_fetch_add(&cache->misses, 1, __ATOMIC_RELAXED);
+    return FALSE;
+}
+
+// claim a slot of the bucket for the key, the matching one, an empty one or a fixed victim
+static cache_slot_t *slot_claim(cache_slot_t *bucket, const U64_T key[2], U32_T *seq) {
+    cache_slot_t *slot = NULL;
+    U32_T w, s;
+
+    for(w = 0; w < CACHE_WAYS && slot == NULL; w++)
+    {
+        s = __atomic_load_n(&bucket[w].seq, __ATOMIC_ACQUIRE);
+        if(s == 0 || (!(s & 1) && bucket[w].entry.key[0] == key[0] &&
+                      bucket[w].entry.key[1] == key[1]))
+            slot = &bucket[w];
+    }
+    if(slot == NULL)
+        slot = &bucket[key[1] % CACHE_WAYS];
+
+    s = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+    if((s & 1) || !__atomic_compare_exchange_n(&slot->seq, &s, s + 1, FALSE, __ATOMIC_ACQUIRE,
+                                               __ATOMIC_RELAXED))
+        return NULL;
+
+    *seq = s + 2;
+    return slot;
+}
+
+static void slot_store(cache_slot_t *bucket, const cache_entry_t *entry) {
+    cache_slot_t *slot;
+    U32_T seq;
+
+    // another writer owns the slot, losing one memo is cheaper than waiting for it
+    if((slot = slot_claim(bucket, entry->key, &seq)) == NULL)
+        return;
+
+    memcpy(&slot->entry, entry, sizeof(*entry));
+    __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+}
+
+void cache_insert(feas_cache_t *cache, const cache_key_t *key, const U32_T order[],
+                  signed char completion, signed char sched_point, signed char edf,
+                  const U32_T resp[]) {
+    cache_entry_t entry;
+    U32_T k, r;
+
+    // whether the hyperperiod fits depends on the scale the canonical form divides out, and an
+    // empty set is cheaper to decide than to look up, cache_load would not take it either
+    if(edf == FEAS_OVERFLOW || key->numServices == 0)
+        return;
+
+    memset(&entry, 0, sizeof(entry));
+    entry.key[0]      = key->key[0];
+    entry.key[1]      = key->key[1];
+    entry.numServices = key->numServices;
+    entry.completion  = completion;
+    entry.sched_point = sched_point;
+    entry.edf         = edf;
+
+    if(resp != NULL && key->numServices <= CACHE_RESP_MAX)
+    {
+        entry.hasResp = TRUE;
+        for(k = 0; k < key->numServices; k++)
+        {
+            // a saturated response time is the only one that is not a multiple of the scale
+            r = resp[at(order, k)];
+            if(r % key->scale != 0)
+            {
+                entry.hasResp = FALSE;
+                break;
+            }
+            entry.resp[k] = r / key->scale;
+        }
+    }
+
+    slot_store(cache_bucket(cache, key->key), &entry);
+}
+
+long cache_load(feas_cache_t *cache, const char *path) {
+    char magic[8];
+    U32_T version, count, k, loaded = 0;
+    cache_entry_t entry;
+    FILE *in;
+
+    if((in = fopen(path, "rb")) == NULL)
+        return 0;
+
+    if(fread(magic, 1, sizeof(magic), in) != sizeof(magic) || memcmp(magic, cacheMagic, 8) != 0 ||
+       fread(&version, sizeof(version), 1, in) != 1 || version != CACHE_VERSION ||
+       fread(&count, sizeof(count), 1, in) != 1)
+    {
+        snprintf(cache->error, sizeof(cache->error), "%s: not a version %u cache file", path,
+                 CACHE_VERSION);
+        fclose(in);
+        return -1;
+    }
+
+    for(k = 0; k < count; k++)
+    {
+        if(fread(&entry, sizeof(entry), 1, in) != 1 ||
+           (entry.hasResp && entry.numServices > CACHE_RESP_MAX))
+        {
+            snprintf(cache->error, sizeof(cache->error), "%s: entry %u of %u is truncated or invalid",
+                     path, k, count);
+            fclose(in);
+            return -1;
+        }
+        // files written before overflow verdicts and empty sets were kept out may hold some
+        if(entry.edf == FEAS_OVERFLOW || entry.numServices == 0)
+            continue;
+        slot_store(cache_bucket(cache, entry.key), &entry);
+        loaded++;
+    }
+
+    fclose(in);
+    return (long)loaded;
+}
+
+int cache_save(feas_cache_t *cache, const char *path) {
+    U64_T slot, numSlots = cache->numBuckets * CACHE_WAYS;
+    U32_T version = CACHE_VERSION, count = 0;
+    FILE *out;
+    int failed;
+
+    for(slot = 0; slot < numSlots; slot++)
+        if(cache->slots[slot].seq != 0 && !(cache->slots[slot].seq & 1))
+            count++;
+
+    if((out = fopen(path, "wb")) == NULL)
+    {
+        snprintf(cache->error, sizeof(cache->error), "%s: cannot write the cache file", path);
+        return -1;
+    }
+
+    fwrite(cacheMagic, 1, sizeof(cacheMagic), out);
+    fwrite(&version, sizeof(version), 1, out);
+    fwrite(&count, sizeof(count), 1, out);
+    for(slot = 0; slot < numSlots; slot++)
+        if(cache->slots[slot].seq != 0 && !(cache->slots[slot].seq & 1))
+            fwrite(&cache->slots[slot].entry, sizeof(cache_entry_t), 1, out);
+
+    failed = ferror(out);
+    if(fclose(out) != 0 || failed)
+    {
+        snprintf(cache->error, sizeof(cache->error), "%s: write failed", path);
+        return -1;
+    }
+
+    return 0;
+}
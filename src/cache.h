@@ -0,0 +1,130 @@
+/**
+ *  @name   cache
+ *  @brief  bounded concurrent memo of single core verdicts keyed by canonical task set
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  A set is canonicalized as its services in analysis priority order with every period,
+ *  WCET and deadline divided by the GCD of all of them. Two sets with the same canonical
+ *  form have the same completion time, scheduling point and EDF verdicts, and response times
+ *  that differ only by that GCD factor. The exception is an EDF FEAS_OVERFLOW, which depends
+ *  on the magnitudes the GCD divides out, so such a set is never memoized. Permuted copies
+ *  of a set hit under PRIO_RM and PRIO_DM, where the order comes from the parameters. Under
+ *  PRIO_GIVEN the order is the priority assignment, so they do not.
+ *
+ *  The key is a 128 bit fingerprint of the canonical form, and the slots hold only that
+ *  fingerprint, so a lookup is a few compares and never touches the task arrays.
+ *
+ *  Slots are 4 way buckets with a per slot sequence lock. Readers never block and retry as
+ *  a miss if a writer got in. A writer that finds its victim slot already being written
+ *  skips the insert. No lock is ever taken, so any number of batch workers share one cache.
+ *
+ *  Persisted file layout, host byte order:
+ *
+ *      0   char    magic[8]        "FEASMEMO"
+ *      8   U32     version         CACHE_VERSION
+ *      12  U32     count           entries that follow
+ *      16          cache_entry_t   entries[count]
+*/
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "feasibility.h"
+
+#define CACHE_VERSION       1
+
+// longest set whose response times are kept, longer sets only keep their verdicts
+#define CACHE_RESP_MAX      16
+
+// memo size when only a persistence file is given
+#define CACHE_DEFAULT_ENTRIES   (1u << 18)
+
+// slots per bucket
+#define CACHE_WAYS          4
+
+typedef struct {
+    U64_T           key[2];
+    U32_T           numServices;
+    signed char     completion;
+    signed char     sched_point;
+    signed char     edf;
+    unsigned char   hasResp;
+    U32_T           resp[CACHE_RESP_MAX];   // canonical, level order
+} cache_entry_t;
+
+typedef struct {
+    volatile U32_T  seq;        // odd while a writer owns the slot, 0 while empty
+    cache_entry_t   entry;
+} cache_slot_t;
+
+typedef struct {
+    cache_slot_t    *slots;
+    U64_T           numBuckets; // power of two
+    volatile U64_T  hits;
+    volatile U64_T  misses;
+    char            error[128];
+} feas_cache_t;
+
+/**
+ *  Canonical form of one set as the batch hands it over, filled by cache_key.
+*/
+typedef struct {
+    U64_T   key[2];
+    U32_T   scale;      // GCD the canonical form was divided by
+    U32_T   numServices;
+} cache_key_t;
+
+/**
+ *  @brief  allocate a cache of at least entries slots, rounded up to whole buckets
+ *
+ *  @return 0, or -1 with cache->error set
+*/
+int cache_init(feas_cache_t *cache, U64_T entries);
+void cache_free(feas_cache_t *cache);
+
+/**
+ *  @brief  canonical fingerprint of the set taken in level order, order NULL for index order
+*/
+void cache_key(cache_key_t *key, U32_T numServices, const U32_T period[], const U32_T wcet[],
+               const U32_T deadline[], const U32_T order[]);
+
+/**
+ *  @brief  look a set up
+ *
+ *  @param  resp    NULL if the response times are not wanted, otherwise filled in the caller's
+ *                  index order (through order[]) and a hit needs them to have been stored
+ *
+ *  @return TRUE on a hit with the verdicts copied out, FALSE otherwise
+*/
+int cache_lookup(feas_cache_t *cache, const cache_key_t *key, const U32_T order[],
+                 signed char *completion, signed char *sched_point, signed char *edf,
+                 U32_T resp[]);
+
+/**
+ *  @brief  store the verdicts of a set, with its response times when resp is not NULL
+ *
+ *  An empty set, or one whose EDF verdict is FEAS_OVERFLOW, is not stored.
+ *  Response times are indexed like the caller's arrays and kept only for sets of at most
+ *  CACHE_RESP_MAX services.
+*/
+void cache_insert(feas_cache_t *cache, const cache_key_t *key, const U32_T order[],
+                  signed char completion, signed char sched_point, signed char edf,
+                  const U32_T resp[]);
+
+/**
+ *  @brief  load entries saved by cache_save into the cache, a missing file is not an error
+ *
+ *  @return entries loaded, or -1 with cache->error set on a malformed file
+*/
+long cache_load(feas_cache_t *cache, const char *path);
+
+/**
+ *  @brief  write every occupied slot out, run with no analysis in flight
+ *
+ *  @return 0, or -1 with cache->error set
+*/
+int cache_save(feas_cache_t *cache, const char *path);
+
+#endif
@@ -0,0 +1,204 @@
+/**
+ *  @name   corpus
+ *  @brief  memory mapped binary task set corpus analyzed in place
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "corpus.h"
+
+#define CORPUS_MAGIC    "FEASCORP"
+#define CORPUS_ALIGN    64
+
+typedef struct {
+    char        magic[8];
+    uint32_t    version;
+    uint32_t    numSets;
+    uint64_t    numTasks;
+    uint64_t    offsetPos;
+    uint64_t    periodPos;
+    uint64_t    wcetPos;
+    uint64_t    deadlinePos;
+    uint64_t    reserved;
+} corpus_header_t;
+
+static uint64_t align_up(uint64_t pos) {
+    return (pos + CORPUS_ALIGN - 1) & ~(uint64_t)(CORPUS_ALIGN - 1);
+}
+
+// a column of count U32 at pos has to sit inside the file and on a U32 boundary
+static int column_ok(const corpus_t *corpus, uint64_t pos, uint64_t count) {
+    return (pos % sizeof(U32_T)) == 0 && pos <= corpus->size &&
+           count <= (corpus->size - pos) / sizeof(U32_T);
+}
+
+int corpus_open(corpus_t *corpus, const char *path) {
+    const corpus_header_t *hdr;
+    struct stat st;
+    const char *base;
+    int fd;
+
+    memset(corpus, 0, sizeof(*corpus));
+
+    if((fd = open(path, O_RDONLY)) < 0 || fstat(fd, &st) != 0)
+    {
+        snprintf(corpus->error, sizeof(corpus->error), "%s: cannot open", path);
+        if(fd >= 0)
+            close(fd);
+        return -1;
+    }
+
+    if((size_t)st.st_size < sizeof(corpus_header_t))
+    {
+        snprintf(corpus->error, sizeof(corpus->error), "%s: too short for a corpus header", path);
+        close(fd);
+        return -1;
+    }
+
+    corpus->size = (size_t)st.st_size;
+    corpus->base = mmap(NULL, corpus->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(corpus->base == MAP_FAILED)
+    {
+        corpus->base = NULL;
+        snprintf(corpus->error, sizeof(corpus->error), "%s: mmap failed", path);
+        return -1;
+    }
+
+    base = (const char *)corpus->base;
+    hdr  = (const corpus_header_t *)base;
+
+    if(memcmp(hdr->magic, CORPUS_MAGIC, sizeof(hdr->magic)) != 0 || hdr->version != CORPUS_VERSION)
+    {
+        snprintf(corpus->error, sizeof(corpus->error), "%s: not a version %d corpus", path, CORPUS_VERSION);
+        corpus_close(corpus);
+        return -1;
+    }
+
+    if(hdr->numTasks > 0xFFFFFFFFull ||
+       !column_ok(corpus, hdr->offsetPos, (uint64_t)hdr->numSets + 1) ||
+       !column_ok(corpus, hdr->periodPos, hdr->numTasks) ||
+       !column_ok(corpus, hdr->wcetPos, hdr->numTasks) ||
+       !column_ok(corpus, hdr->deadlinePos, hdr->numTasks))
+    {
+        snprintf(corpus->error, sizeof(corpus->error), "%s: columns do not fit the file", path);
+        corpus_close(corpus);
+        return -1;
+    }
+
+    corpus->batch.numSets  = hdr->numSets;
+    corpus->batch.offset   = (const U32_T *)(base + hdr->offsetPos);
+    corpus->batch.period   = (const U32_T *)(base + hdr->periodPos);
+    corpus->batch.wcet     = (const U32_T *)(base + hdr->wcetPos);
+    corpus->batch.deadline = (const U32_T *)(base + hdr->deadlinePos);
+
+    if(corpus->batch.offset[0] != 0 || corpus->batch.offset[hdr->numSets] != hdr->numTasks)
+    {
+        snprintf(corpus->error, sizeof(corpus->error), "%s: offset index does not cover the columns", path);
+        corpus_close(corpus);
+        return -1;
+    }
+
+    // analysis walks the columns front to back
+    madvise(corpus->base, corpus->size, MADV_SEQUENTIAL);
+
+    return 0;
+}
+
+void corpus_close(corpus_t *corpus) {
+    if(corpus->base != NULL)
+        munmap(corpus->base, corpus->size);
+
+    corpus->base = NULL;
+    corpus->size = 0;
+}
+
+int corpus_verify(corpus_t *corpus) {
+    const taskset_batch_t *b = &corpus->batch;
+    U32_T s, t;
+
+    for(s = 0; s < b->numSets; s++)
+    {
+        if(b->offset[s + 1] < b->offset[s])
+        {
+            snprintf(corpus->error, sizeof(corpus->error), "set %u: offsets go backwards", s);
+            return -1;
+        }
+
+        for(t = b->offset[s]; t < b->offset[s + 1]; t++)
+        {
+            if(b->period[t] == 0)
+            {
+                snprintf(corpus->error, sizeof(corpus->error), "set %u: period must be non-zero", s);
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int write_column(FILE *out, uint64_t *pos, const U32_T *col, uint64_t count) {
+    static const char pad[CORPUS_ALIGN];
+    uint64_t at = align_up(*pos);
+
+    if(at > *pos && fwrite(pad, 1, (size_t)(at - *pos), out) != (size_t)(at - *pos))
+        return -1;
+    if(count > 0 && fwrite(col, sizeof(U32_T), (size_t)count, out) != (size_t)count)
+        return -1;
+
+    *pos = at + count * sizeof(U32_T);
+    return 0;
+}
+
+int corpus_write(FILE *out, const taskset_batch_t *batch) {
+    corpus_header_t hdr;
+    uint64_t pos = sizeof(hdr);
+    uint64_t numTasks = batch->offset[batch->numSets];
+    U32_T base = batch->offset[0];
+    U32_T s, *rebased = NULL;
+    int rc;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, CORPUS_MAGIC, sizeof(hdr.magic));
+    hdr.version     = CORPUS_VERSION;
+    hdr.numSets     = batch->numSets;
+    hdr.numTasks    = numTasks - base;
+    hdr.offsetPos   = align_up(pos);
+    hdr.periodPos   = align_up(hdr.offsetPos + ((uint64_t)batch->numSets + 1) * sizeof(U32_T));
+    hdr.wcetPos     = align_up(hdr.periodPos + hdr.numTasks * sizeof(U32_T));
+    hdr.deadlinePos = align_up(hdr.wcetPos + hdr.numTasks * sizeof(U32_T));
+
+    if(fwrite(&hdr, sizeof(hdr), 1, out) != 1)
+        return -1;
+
+    // sub-batch views carry absolute offsets, the file index always starts at 0
+    if(base != 0)
+    {
+        if((rebased = malloc(sizeof(U32_T) * ((size_t)batch->numSets + 1))) == NULL)
+            return -1;
+        for(s = 0; s <= batch->numSets; s++)
+            rebased[s] = batch->offset[s] - base;
+    }
+
+    rc = write_column(out, &pos, rebased ? rebased : batch->offset, (uint64_t)batch->numSets + 1);
+    free(rebased);
+
+    if(rc != 0 ||
+       write_column(out, &pos, batch->period + base, hdr.numTasks) != 0 ||
+       write_column(out, &pos, batch->wcet + base, hdr.numTasks) != 0 ||
+       write_column(out, &pos, batch->deadline + base, hdr.numTasks) != 0)
+        return -1;
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ *  @name   corpus
+ *  @brief  memory mapped binary task set corpus analyzed in place
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  File layout, host byte order, every column starts on a 64 byte boundary:
+ *
+ *      0   char    magic[8]        "FEASCORP"
+ *      8   U32     version         CORPUS_VERSION
+ *      12  U32     numSets
+ *      16  U64     numTasks        must fit a U32, the batch offsets are 32 bit
+ *      24  U64     offsetPos       file position of U32 offset[numSets + 1]
+ *      32  U64     periodPos       file position of U32 period[numTasks]
+ *      40  U64     wcetPos         file position of U32 wcet[numTasks]
+ *      48  U64     deadlinePos     file position of U32 deadline[numTasks]
+ *      56  U64     reserved
+ *
+ *  The columns are exactly the taskset_batch_t layout, so the batch handed out by
+ *  corpus_open points straight into the mapping and nothing is parsed or copied.
+*/
+
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "batch.h"
+
+#define CORPUS_VERSION  1
+
+typedef struct {
+    void            *base;
+    size_t          size;
+    taskset_batch_t batch;
+    char            error[128];
+} corpus_t;
+
+/**
+ *  @brief  map a corpus read only, only the header is checked so this is O(1) in the file size
+ *
+ *  @return 0 on success, -1 with corpus->error set otherwise
+*/
+int corpus_open(corpus_t *corpus, const char *path);
+void corpus_close(corpus_t *corpus);
+
+/**
+ *  @brief  full pass over the index and periods for corpora that did not come from corpus_write
+ *
+ *  @return 0 if the offsets are monotonic and no period is zero, -1 with corpus->error set otherwise
+*/
+int corpus_verify(corpus_t *corpus);
+
+/**
+ *  @brief  write a batch out in corpus format
+ *
+ *  @return 0 on success, -1 on a write error
+*/
+int corpus_write(FILE *out, const taskset_batch_t *batch);
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ *  @name   edf
+ *  @brief  exact single core EDF feasibility by processor demand analysis
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <math.h>
+
+#include "edf.h"
+#include "instrument.h"
+
+#define U64_MAX 0xFFFFFFFFFFFFFFFFull
+
+U64_T edf_demand(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                 const U32_T deadline[], U64_T t) {
+    unsigned __int128 demand = 0;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+    {
+        if(deadline[i] <= t)
+            demand += (unsigned __int128)((t - deadline[i]) / period[i] + 1) * wcet[i];
+    }
+
+    // saturate, callers only ever compare the demand against t
+    return (demand > U64_MAX) ? U64_MAX : (U64_T)demand;
+}
+
+// latest absolute deadline k*T(i) + D(i) strictly before t, 0 when there is none
+static U64_T edf_prev_deadline(U32_T numServices, const U32_T period[], const U32_T deadline[], U64_T t) {
+    U64_T best = 0, d;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+    {
+        if(deadline[i] >= t)
+            continue;
+
+        d = ((t - deadline[i] - 1) / period[i]) * period[i] + deadline[i];
+        if(d > best)
+            best = d;
+    }
+
+    return best;
+}
+
+static U64_T gcd64(U64_T a, U64_T b) {
+    U64_T r;
+
+    while(b != 0)
+    {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+// hyperperiod of the services with work, the U = 1 busy period, 0 if it does not fit
+static U64_T edf_hyperperiod(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    U64_T lcm = 1, step;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+    {
+        if(wcet[i] == 0)
+            continue;
+        step = period[i] / gcd64(lcm, period[i]);
+        if(__builtin_mul_overflow(lcm, step, &lcm))
+            return 0;
+    }
+
+    return lcm;
+}
+
+U64_T edf_busy_period(U32_T numServices, const U32_T period[], const U32_T wcet[], U64_T limit) {
+    unsigned __int128 w = 0, next;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+        w += wcet[i];
+
+    // W(t) only grows with t, so the iteration climbs monotonically onto the least fixed point
+    while(w < limit)
+    {
+        for(next = 0, i = 0; i < numServices; i++)
+            next += (unsigned __int128)((U64_T)((w + period[i] - 1) / period[i])) * wcet[i];
+
+        if(next == w)
+            return (U64_T)w;
+        w = next;
+    }
+
+    return limit;
+}
+
+// Zhang and Burns La = max(max(D(i) - T(i)), sum (T(i) - D(i))*U(i) / (1 - U)), rounded up
+static U64_T edf_la_bound(U32_T numServices, const U32_T period[], const U32_T wcet[], const U32_T deadline[]) {
+    long double util = 0.0L, slack = 0.0L, la;
+    U64_T best = 0;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+    {
+        util  += (long double)wcet[i] / (long double)period[i];
+        slack += ((long double)period[i] - (long double)deadline[i]) * wcet[i] / (long double)period[i];
+        if(deadline[i] > period[i] && deadline[i] - period[i] > best)
+            best = deadline[i] - period[i];
+    }
+
+    // only reached for U < 1, a larger bound only costs time, so round generously
+    la = ceill(slack / (1.0L - util)) + 1.0L;
+    if(!(la < (long double)U64_MAX))
+        return U64_MAX;
+
+    // D > T services can make the slack negative, the D - T term is then the bound
+    if(la < 0.0L)
+        la = 0.0L;
+
+    return ((U64_T)la > best) ? (U64_T)la : best;
+}
+
+int edf_demand_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[]) {
+    U64_T horizon, t, h, dmin = U64_MAX, steps = 0;
+    int cmp, d_ge_t = TRUE;
+    U32_T i;
+    FEAS_TRACE_BEGIN();
+
+    if(numServices == 0)
+        return TRUE;
+
+    cmp = utilization_compare_one(numServices, period, wcet);
+    if(cmp > 0)
+    {
+        FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_UTIL, numServices, steps);
+        return FALSE;
+    }
+
+    for(i = 0; i < numServices; i++)
+    {
+        // a single job that cannot fit its own window needs no demand analysis
+        if(wcet[i] > deadline[i])
+        {
+            FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_PRUNED, numServices, steps);
+            return FALSE;
+        }
+        if(deadline[i] < dmin)
+            dmin = deadline[i];
+        d_ge_t &= deadline[i] >= period[i];
+    }
+
+    // with D >= T the demand never outruns U*t, the Liu and Layland condition is exact
+    if(d_ge_t)
+    {
+        FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_SHORTCUT, numServices, steps);
+        return TRUE;
+    }
+
+    // a first miss always lies inside the synchronous busy period L, which ends before La
+    // whenever U < 1 and, at U = 1, is exactly the hyperperiod
+    if(cmp < 0)
+        horizon = edf_busy_period(numServices, period, wcet,
+                                  edf_la_bound(numServices, period, wcet, deadline));
+    else if((horizon = edf_hyperperiod(numServices, period, wcet)) == 0)
+    {
+        FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_OVERFLOW, numServices, steps);
+        return FEAS_OVERFLOW;
+    }
+
+    // QPA, walk down from the last deadline before the horizon, h(L) <= W(L) = L always holds
+    t = edf_prev_deadline(numServices, period, deadline, horizon);
+    while(t > 0)
+    {
+        h = edf_demand(numServices, period, wcet, deadline, t);
+        steps++;
+
+        if(h > t)
+        {
+            FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_MISS, numServices, steps);
+            return FALSE;
+        }
+        if(h <= dmin)
+            break;
+
+        t = (h < t) ? h : edf_prev_deadline(numServices, period, deadline, t);
+    }
+
+    FEAS_TRACE_END(FEAS_TEST_EDF, FEAS_EXIT_FEASIBLE, numServices, steps);
+    return TRUE;
+}
@@ -0,0 +1,51 @@
+/**
+ *  @name   edf
+ *  @brief  exact single core EDF feasibility by processor demand analysis
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Zhang, Fengxiang, and Alan Burns. "Schedulability analysis for real-time systems with EDF scheduling."
+ *          IEEE Transactions on Computers 58.9 (2009): 1250-1258.
+ *  @cite   Baruah, Sanjoy K., Louis E. Rosier, and Rodney R. Howell. "Algorithms and complexity concerning the
+ *          preemptive scheduling of periodic, real-time tasks on one processor." Real-Time Systems 2.4 (1990): 301-324.
+*/
+
+#ifndef EDF_H
+#define EDF_H
+
+#include "feasibility.h"
+
+/**
+ *  @brief  h(t) = sum over D(i) <= t of (floor((t - D(i))/T(i)) + 1)*C(i), the EDF demand bound
+*/
+U64_T edf_demand(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                 const U32_T deadline[], U64_T t);
+
+/**
+ *  @brief  length of the synchronous busy period, the least fixed point of
+ *          W(t) = sum ceil(t/T(i))*C(i) iterated up from sum C(i)
+ *
+ *  @param  limit   the iteration stops there, the busy period is unbounded for U > 1 and
+ *                  can be as long as the hyperperiod for U = 1
+ *
+ *  @return the busy period, or limit if it is not shorter
+*/
+U64_T edf_busy_period(U32_T numServices, const U32_T period[], const U32_T wcet[], U64_T limit);
+
+/**
+ *  @brief  EDF test with Quick Processor-demand Analysis (QPA)
+ *
+ *  U > 1 is rejected up front and D >= T sets are decided by U <= 1 alone. Everything else
+ *  walks h(t) downward from the largest absolute deadline inside the synchronous busy period
+ *  L, jumping straight to h(t) whenever it is below t, so only a handful of deadlines are
+ *  ever evaluated. For U < 1 the L iteration stops at the Zhang and Burns La bound and never
+ *  touches the hyperperiod. For U = 1, L is the hyperperiod. Services can be in any order.
+ *  LLF is optimal on one core as well, so the verdict holds for it too.
+ *
+ *  @return TRUE, FALSE, or FEAS_OVERFLOW if a U = 1 hyperperiod does not fit 64 bits
+*/
+int edf_demand_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[]);
+
+#endif
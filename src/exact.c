@@ -0,0 +1,421 @@
+/**
+ *  @name   exact
+ *  @brief  exact rational comparisons of utilization against 1, the RM LUB and the hyperbolic bound
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "exact.h"
+
+// integers of up to this many limbs live in the caller's stack buffer, larger ones are allocated
+#define BIG_STACK_LIMBS     64
+
+// little endian 64 bit limbs, len never counts a leading zero limb
+typedef struct {
+    U32_T   len;
+    U32_T   cap;        // most limbs a result may take, d holds one more for carries
+    U64_T   *d;
+    int     owned;      // d came from malloc
+} big_t;
+
+// room for limbs, from stack when it fits in BIG_STACK_LIMBS, capped at EXACT_MAX_LIMBS
+static int big_init(big_t *a, U64_T value, U32_T limbs, U64_T stack[BIG_STACK_LIMBS]) {
+    limbs = (limbs < 2) ? 2 : (limbs > EXACT_MAX_LIMBS) ? EXACT_MAX_LIMBS : limbs;
+
+    a->owned = (limbs + 1 > BIG_STACK_LIMBS);
+    a->d     = a->owned ? malloc(sizeof(U64_T) * (limbs + 1)) : stack;
+    if(a->d == NULL)
+        return -1;
+
+    a->cap  = limbs;
+    a->d[0] = value;
+    a->len  = (value != 0) ? 1 : 0;
+    return 0;
+}
+
+static void big_free(big_t *a) {
+    if(a->owned)
+        free(a->d);
+    a->d     = NULL;
+    a->owned = FALSE;
+}
+
+static void big_set128(big_t *a, unsigned __int128 value) {
+    a->d[0] = (U64_T)value;
+    a->d[1] = (U64_T)(value >> 64);
+    a->len  = (a->d[1] != 0) ? 2 : (a->d[0] != 0) ? 1 : 0;
+}
+
+// a *= w, -1 once a would pass its cap
+static int big_mul_word(big_t *a, U64_T w) {
+    unsigned __int128 carry = 0;
+    U32_T k;
+
+    for(k = 0; k < a->len; k++)
+    {
+        carry  += (unsigned __int128)a->d[k] * w;
+        a->d[k] = (U64_T)carry;
+        carry >>= 64;
+    }
+
+    if(carry != 0)
+    {
+        if(a->len == a->cap)
+            return -1;
+        a->d[a->len++] = (U64_T)carry;
+    }
+    if(w == 0)
+        a->len = 0;
+
+    return 0;
+}
+
+// acc += b * w
+static int big_addmul_word(big_t *acc, const big_t *b, U64_T w) {
+    unsigned __int128 carry = 0;
+    U32_T k;
+
+    if(b->len > acc->cap)
+        return -1;
+    while(acc->len < b->len)
+        acc->d[acc->len++] = 0;
+
+    for(k = 0; k < acc->len; k++)
+    {
+        carry      += (unsigned __int128)acc->d[k] + ((k < b->len) ? (unsigned __int128)b->d[k] * w : 0);
+        acc->d[k]   = (U64_T)carry;
+        carry     >>= 64;
+    }
+
+    if(carry != 0)
+    {
+        if(acc->len == acc->cap)
+            return -1;
+        acc->d[acc->len++] = (U64_T)carry;
+    }
+    while(acc->len > 0 && acc->d[acc->len - 1] == 0)
+        acc->len--;
+
+    return 0;
+}
+
+// out = a * b, out distinct from both
+static int big_mul(big_t *out, const big_t *a, const big_t *b) {
+    unsigned __int128 t;
+    U64_T carry;
+    U32_T i, j;
+
+    if(a->len == 0 || b->len == 0)
+    {
+        out->len = 0;
+        return 0;
+    }
+    if(a->len + b->len > out->cap)
+        return -1;
+
+    for(i = 0; i < a->len + b->len; i++)
+        out->d[i] = 0;
+
+    for(i = 0; i < a->len; i++)
+    {
+        carry = 0;
+        for(j = 0; j < b->len; j++)
+        {
+            t = (unsigned __int128)a->d[i] * b->d[j] + out->d[i + j] + carry;
+            out->d[i + j] = (U64_T)t;
+            carry = (U64_T)(t >> 64);
+        }
+        out->d[i + b->len] = carry;
+    }
+
+    out->len = a->len + b->len;
+    while(out->len > 0 && out->d[out->len - 1] == 0)
+        out->len--;
+
+    return 0;
+}
+
+static int big_cmp(const big_t *a, const big_t *b) {
+    U32_T k;
+
+    if(a->len != b->len)
+        return (a->len < b->len) ? -1 : 1;
+
+    for(k = a->len; k-- > 0;)
+        if(a->d[k] != b->d[k])
+            return (a->d[k] < b->d[k]) ? -1 : 1;
+
+    return 0;
+}
+
+// C(i) from whichever column the caller has, the plain WCETs or 64 bit per job costs
+static inline U64_T work(const U32_T wcet[], const U64_T cost[], U32_T idx) {
+    return (cost != NULL) ? cost[idx] : wcet[idx];
+}
+
+static unsigned __int128 gcd128(unsigned __int128 a, unsigned __int128 b) {
+    unsigned __int128 r;
+
+    while(b != 0)
+    {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+// U = num/den reduced over the lcm of the periods, FALSE once it stops fitting 128 bits
+static int util_rational128(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                            const U64_T cost[], unsigned __int128 *numOut, unsigned __int128 *denOut) {
+    unsigned __int128 num = 0, den = 1, g, scale, term;
+    U32_T idx;
+
+    for(idx = 0; idx < numServices; idx++)
+    {
+        g     = gcd128(den, period[idx]);
+        scale = period[idx] / g;
+        if(__builtin_mul_overflow(den, scale, &den) ||
+           __builtin_mul_overflow(num, scale, &num) ||
+           __builtin_mul_overflow((unsigned __int128)work(wcet, cost, idx), den / period[idx], &term) ||
+           __builtin_add_overflow(num, term, &num))
+            return FALSE;
+
+        // keep the fraction reduced so harmonic sets never grow the denominator
+        g = gcd128(num, den);
+        if(g > 1)
+        {
+            num /= g;
+            den /= g;
+        }
+    }
+
+    *numOut = num;
+    *denOut = den;
+    return TRUE;
+}
+
+// U = num/den over the plain product of the periods, -1 past the cap
+static int util_rational_big(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                             const U64_T cost[], big_t *num, big_t *den) {
+    U32_T idx;
+
+    num->len = 0;
+    den->d[0] = 1;
+    den->len  = 1;
+
+    // num/den + C/T = (num T + C den) / (den T)
+    for(idx = 0; idx < numServices; idx++)
+    {
+        if(big_mul_word(num, period[idx]) != 0 ||
+           big_addmul_word(num, den, work(wcet, cost, idx)) != 0 ||
+           big_mul_word(den, period[idx]) != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static long double util_long(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                             const U64_T cost[]) {
+    long double u = 0.0L;
+    U32_T idx;
+
+    for(idx = 0; idx < numServices; idx++)
+        u += (long double)work(wcet, cost, idx) / (long double)period[idx];
+
+    return u;
+}
+
+// limbs of num and den of U over the product of the periods
+static inline U32_T util_limbs(U32_T numServices) {
+    return numServices / 2 + 3;
+}
+
+static inline int sign_ld(long double a, long double b) {
+    return (a < b) ? -1 : (a == b) ? 0 : 1;
+}
+
+static int util_compare(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                        const U64_T cost[], double util) {
+    double margin = (double)(numServices + 2) * DBL_EPSILON * ((util > 1.0) ? util : 1.0);
+    U64_T sn[BIG_STACK_LIMBS], sd[BIG_STACK_LIMBS];
+    unsigned __int128 num, den;
+    big_t bnum = { 0 }, bden = { 0 };
+    int cmp;
+
+    if(util > 1.0 + margin)
+        return 1;
+    if(util < 1.0 - margin)
+        return -1;
+
+    if(util_rational128(numServices, period, wcet, cost, &num, &den))
+        return (num < den) ? -1 : (num == den) ? 0 : 1;
+
+    // num takes at most 32(n - 1) + 64 + log2(n) bits and den 32 n, see util_limbs
+    if(big_init(&bnum, 0, util_limbs(numServices), sn) == 0 &&
+       big_init(&bden, 1, util_limbs(numServices), sd) == 0 &&
+       util_rational_big(numServices, period, wcet, cost, &bnum, &bden) == 0)
+        cmp = big_cmp(&bnum, &bden);
+    else
+        cmp = sign_ld(util_long(numServices, period, wcet, cost), 1.0L);
+
+    big_free(&bnum);
+    big_free(&bden);
+    return cmp;
+}
+
+int exact_util_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[], double util) {
+    return util_compare(numServices, period, wcet, NULL, util);
+}
+
+int exact_util_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    return exact_util_compare_from(numServices, period, wcet, rm_utilization(numServices, period, wcet));
+}
+
+int exact_cost_compare(U32_T numServices, const U32_T period[], const U64_T cost[]) {
+    double util = 0.0;
+    U32_T idx;
+
+    for(idx = 0; idx < numServices; idx++)
+        util += (double)cost[idx] / (double)period[idx];
+
+    return util_compare(numServices, period, NULL, cost, util);
+}
+
+// (num + n den)^n against 2 (n den)^n, -2 past the cap
+static int lub_tie(U32_T n, big_t *num, big_t *den) {
+    U64_T sx[BIG_STACK_LIMBS], sy[BIG_STACK_LIMBS], spx[BIG_STACK_LIMBS], spy[BIG_STACK_LIMBS],
+          stmp[BIG_STACK_LIMBS];
+    big_t x = { 0 }, y = { 0 }, px = { 0 }, py = { 0 }, tmp = { 0 }, swap;
+    U32_T base = ((num->len > den->len) ? num->len : den->len) + 1;
+    U64_T powers = (U64_T)n * base + 1;
+    U32_T limbs = (powers > EXACT_MAX_LIMBS) ? EXACT_MAX_LIMBS : (U32_T)powers;
+    U32_T k;
+    int cmp = -2;
+
+    // x and y take at most one limb over num and den, their n-th powers n times that
+    if(big_init(&x, 0, base, sx) != 0 || big_init(&y, 0, base, sy) != 0 ||
+       big_init(&px, 1, limbs, spx) != 0 || big_init(&py, 2, limbs, spy) != 0 ||
+       big_init(&tmp, 0, limbs, stmp) != 0)
+        goto done;
+
+    // y = n den, x = num + y
+    if(big_addmul_word(&y, den, n) != 0 || big_addmul_word(&x, num, 1) != 0 ||
+       big_addmul_word(&x, &y, 1) != 0)
+        goto done;
+
+    for(k = 0; k < n; k++)
+    {
+        if(big_mul(&tmp, &px, &x) != 0)
+            goto done;
+        swap = px; px = tmp; tmp = swap;
+        if(big_mul(&tmp, &py, &y) != 0)
+            goto done;
+        swap = py; py = tmp; tmp = swap;
+    }
+
+    cmp = big_cmp(&px, &py);
+
+done:
+    big_free(&x);
+    big_free(&y);
+    big_free(&px);
+    big_free(&py);
+    big_free(&tmp);
+    return cmp;
+}
+
+int exact_lub_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[], double util) {
+    double lub = rm_lub_bound(numServices), top = (util > lub) ? util : lub;
+    double margin = (double)(4 * numServices + 8) * DBL_EPSILON * ((top > 1.0) ? top : 1.0);
+    U64_T sn[BIG_STACK_LIMBS], sd[BIG_STACK_LIMBS];
+    unsigned __int128 num, den;
+    long double lubLong;
+    big_t bnum = { 0 }, bden = { 0 };
+    int cmp = -2;
+
+    if(numServices <= 1)
+        return exact_util_compare_from(numServices, period, wcet, util);
+    if(util > lub + margin)
+        return 1;
+    if(util < lub - margin)
+        return -1;
+
+    if(big_init(&bnum, 0, util_limbs(numServices), sn) == 0 &&
+       big_init(&bden, 1, util_limbs(numServices), sd) == 0)
+    {
+        if(util_rational128(numServices, period, wcet, NULL, &num, &den))
+        {
+            big_set128(&bnum, num);
+            big_set128(&bden, den);
+            cmp = lub_tie(numServices, &bnum, &bden);
+        }
+        else if(util_rational_big(numServices, period, wcet, NULL, &bnum, &bden) == 0)
+            cmp = lub_tie(numServices, &bnum, &bden);
+    }
+    big_free(&bnum);
+    big_free(&bden);
+
+    if(cmp != -2)
+        return cmp;
+
+    lubLong = (long double)numServices * (powl(2.0L, 1.0L / (long double)numServices) - 1.0L);
+    return sign_ld(util_long(numServices, period, wcet, NULL), lubLong);
+}
+
+int exact_lub_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    return exact_lub_compare_from(numServices, period, wcet, rm_utilization(numServices, period, wcet));
+}
+
+int exact_hyperbolic_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                  double hyper) {
+    double margin = (double)(3 * numServices + 2) * DBL_EPSILON * ((hyper > 2.0) ? hyper : 2.0);
+    U64_T sa[BIG_STACK_LIMBS], sb[BIG_STACK_LIMBS];
+    long double prod = 1.0L;
+    big_t a = { 0 }, b = { 0 };
+    U32_T idx, limbs;
+    int cmp = -2;
+
+    if(hyper > 2.0 + margin)
+        return 1;
+    if(hyper < 2.0 - margin)
+        return -1;
+
+    // every factor of either product takes at most 33 bits
+    limbs = (U32_T)(((U64_T)numServices * 33 + 1) / 64 + 2);
+    if(big_init(&a, 1, limbs, sa) == 0 && big_init(&b, 2, limbs, sb) == 0)
+    {
+        for(idx = 0; idx < numServices; idx++)
+            if(big_mul_word(&a, (U64_T)wcet[idx] + period[idx]) != 0 ||
+               big_mul_word(&b, period[idx]) != 0)
+                break;
+        if(idx == numServices)
+            cmp = big_cmp(&a, &b);
+    }
+    big_free(&a);
+    big_free(&b);
+
+    if(cmp != -2)
+        return cmp;
+
+    for(idx = 0; idx < numServices; idx++)
+        prod *= 1.0L + (long double)wcet[idx] / (long double)period[idx];
+    return sign_ld(prod, 2.0L);
+}
+
+int exact_hyperbolic_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    double hyper = 1.0;
+    U32_T idx;
+
+    for(idx = 0; idx < numServices; idx++)
+        hyper *= (double)wcet[idx] / (double)period[idx] + 1.0;
+
+    return exact_hyperbolic_compare_from(numServices, period, wcet, hyper);
+}
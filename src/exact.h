@@ -0,0 +1,71 @@
+/**
+ *  @name   exact
+ *  @brief  exact rational comparisons of utilization against 1, the RM LUB and the hyperbolic bound
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  Each comparison is a filtered predicate. The double sum or product is taken first, and
+ *  its rounding error is bounded by a small multiple of n * DBL_EPSILON. A set outside that
+ *  band is decided by the double value alone, which is already the exact answer. Only sets
+ *  inside it take the integer path:
+ *
+ *      U vs 1      sum over a common denominator in 128 bits, kept reduced, then arbitrary
+ *                  precision
+ *      U vs LUB    U <= n(2^(1/n) - 1)  <=>  (num + n den)^n <= 2 (n den)^n, with U = num/den
+ *      hyperbolic  prod(U(i) + 1) <= 2   <=>  prod(C(i) + T(i)) <= 2 prod(T(i))
+ *
+ *  Each integer is sized from n and the operand widths before it is built. Those within 512
+ *  bytes, which covers every tie break of up to about 20 services, live on the stack, so the
+ *  kernels do not allocate for them. The
+ *  integers are capped at EXACT_MAX_LIMBS 64 bit words, about 8000 services for the
+ *  hyperbolic product. A tie past the cap falls back to long double, it stays deterministic
+ *  but is no longer exact. n(2^(1/n) - 1) is irrational for n >= 2, so U never equals the
+ *  LUB there.
+*/
+
+#ifndef EXACT_H
+#define EXACT_H
+
+#include "feasibility.h"
+
+// largest integer the tie breaks build, 32 KiB
+#define EXACT_MAX_LIMBS     4096
+
+/**
+ *  @brief  sign of U - 1
+ *
+ *  @return -1, 0 or 1
+*/
+int exact_util_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]);
+
+/**
+ *  @brief  sign of U - 1 with 64 bit per job costs in place of the WCETs
+ *
+ *  For analyses that charge every job more than C(i), such as the context switches of
+ *  blocking_rta. A cost must stay below 2^53 for the double filter to hold.
+*/
+int exact_cost_compare(U32_T numServices, const U32_T period[], const U64_T cost[]);
+
+/**
+ *  @brief  sign of U - n(2^(1/n) - 1), 0 only for n = 1 and U = 1
+*/
+int exact_lub_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]);
+
+/**
+ *  @brief  sign of prod(U(i) + 1) - 2
+*/
+int exact_hyperbolic_compare(U32_T numServices, const U32_T period[], const U32_T wcet[]);
+
+/**
+ *  @brief  the same three comparisons given the double U, or product, the caller already has
+ *
+ *  The value must come from the plain left to right sum of correctly rounded C(i)/T(i), or
+ *  product of C(i)/T(i) + 1, for the error band to hold.
+*/
+int exact_util_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[], double util);
+int exact_lub_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[], double util);
+int exact_hyperbolic_compare_from(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                  double hyper);
+
+#endif
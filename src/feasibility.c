@@ -0,0 +1,633 @@
+/**
+ *  @name   feasibility
+ *  @brief  RM LUB, completion time and scheduling point feasibility kernels
+ *
+ *  Pure compute only: no stdio, no mutable globals, safe to call from any thread.
+ *  Printing lives in report.c.
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   original kernels by Sam Siewert, see feasibility_tests.c for the references
+*/
+
+#include <math.h>
+#include <stddef.h>
+
+#include "exact.h"
+#include "feasibility.h"
+#include "instrument.h"
+
+// exact ceil(a/b) for unsigned operands, no trip through double
+static inline U32_T ceil_div(U32_T a, U32_T b) {
+    return (a / b) + ((a % b) != 0);
+}
+
+static inline U64_T ceil_div64(U64_T a, U64_T b) {
+    return (a / b) + ((a % b) != 0);
+}
+
+// largest intermediate the 32 bit kernels can hold
+#define FEAS_U32_MAX    0xFFFFFFFFull
+
+// a wide result past 32 bits is past every deadline, report it as the largest U32
+static inline U32_T clamp32(U64_T value) {
+    return (value > FEAS_U32_MAX) ? (U32_T)FEAS_U32_MAX : (U32_T)value;
+}
+
+int feasibility_fits_32(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                        const U32_T deadline[]) {
+    U64_T dmax = 0, cmax = 0, horizon, bound;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+    {
+        if(deadline[i] > dmax)
+            dmax = deadline[i];
+        if(wcet[i] > cmax)
+            cmax = wcet[i];
+    }
+
+    // every iterate and scheduling point the kernels visit is at most D + C of some service
+    horizon = dmax + cmax;
+    if(horizon > FEAS_U32_MAX)
+        return FALSE;
+
+    // and every sum they build is at most C(i) + sum_j ceil(horizon/T(j))*C(j)
+    bound = cmax;
+    for(i = 0; i < numServices; i++)
+    {
+        bound += (horizon / period[i] + 1) * wcet[i];
+        if(bound > FEAS_U32_MAX)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+// n(2^(1/n) - 1), index 0 is the trivially feasible empty set
+static const double lub_table[LUB_TABLE_SIZE + 1] = {
+    1,
+    1,    0.82842712474619029,    0.77976314968461957,    0.75682846001088411,
+    0.74349177498517549,    0.7347722898562381,    0.72862659571668575,    0.72406186132206152,
+    0.72053765003075498,    0.71773462536293131,    0.71545198383958941,    0.71355713231154372,
+    0.71195899426140663,    0.71059294114507221,    0.70941184230940091,    0.70838051883862008,
+    0.70747218105992538,    0.70666606857318115,    0.70594584447764586,    0.70529847682755165,
+    0.70471344314758211,    0.70418215415261143,    0.70369752929621687,    0.70325367944380979,
+    0.70284566640166357,    0.70246931842808502,    0.70212108709004339,    0.70179793504448895,
+    0.70149724722091911,    0.70121675990324928,    0.70095450363931811,    0.70070875693173207,
+    0.70047800840701546,    0.70026092570594711,    0.70005632974196486,    0.69986317327721359,
+    0.69968052299427463,    0.69950754441587515,    0.69934348915823219,    0.6991876841074518,
+    0.69903952218870025,    0.69889845446129062,    0.69876398332273437,    0.69863565664426108,
+    0.69851306269237745,    0.69839582571602721,    0.69828360209994789,    0.69817607700113982,
+    0.69807296139903641,    0.69797398950145473,    0.69787891645696698,    0.69778751633241765,
+    0.69769958032048196,    0.69761491514712315,    0.6975333416535634,    0.69745469353084033,
+    0.69737881618803921,    0.69730556573808444,    0.69723480808714955,    0.69716641811535141,
+    0.69710027893844728,    0.69703628124120476,    0.69697432267441806,    0.69691430730883042,
+};
+
+double rm_lub_bound(U32_T numServices) {
+    if(numServices <= LUB_TABLE_SIZE)
+        return lub_table[numServices];
+
+    return (double)numServices * (pow(2.0, 1.0 / (double)numServices) - 1.0);
+}
+
+double rm_utilization(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    double utility_sum = 0.0;
+    U32_T idx;
+
+    // Sum the C(i) over the T(i)
+    for(idx = 0; idx < numServices; idx++)
+        utility_sum += ((double)wcet[idx] / (double)period[idx]);
+
+    return utility_sum;
+}
+
+int utilization_compare_one(U32_T numServices, const U32_T period[], const U32_T wcet[]) {
+    return exact_util_compare(numServices, period, wcet);
+}
+
+int rate_monotonic_least_upper_bound(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                     const U32_T deadline[]) {
+    (void)deadline;
+
+    // Compare the utilty to the bound and return feasibility, ties decided by exact arithmetic
+    if(exact_lub_compare(numServices, period, wcet) <= 0)
+        return TRUE;
+    else
+        return FALSE;
+}
+
+// service at priority level k, order == NULL means the arrays are already in priority order
+static inline U32_T at(const U32_T order[], U32_T k) {
+    return (order == NULL) ? k : order[k];
+}
+
+// shared fixed point loop for the service at level i, iterations counts the passes over
+// the higher priority services
+static inline U32_T rta_fixed_point(U32_T i, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], const U32_T order[], U32_T start,
+                                    U32_T *iterations) {
+    U32_T j, oj, passes = 0;
+    U32_T oi = at(order, i);
+    U32_T an = start, anext;
+
+    // a job with no work completes the instant it is released
+    if(wcet[oi] == 0)
+        return 0;
+
+    while(1)
+    {
+        anext = wcet[oi];
+        passes++;
+
+        for(j = 0; j < i; j++)
+        {
+            oj     = at(order, j);
+            anext += ceil_div(an, period[oj]) * wcet[oj];
+        }
+
+        if(anext == an)
+            break;
+
+        an = anext;
+
+        // the iterates only grow, once past D(i) the service can never make it
+        if(an > deadline[oi])
+            break;
+    }
+
+    *iterations += passes;
+    return an;
+}
+
+// rta_fixed_point in 64 bits, a product or sum that would wrap is reported as a miss since
+// it is already past any 32 bit deadline
+static inline U64_T rta_fixed_point_wide(U32_T i, const U32_T period[], const U32_T wcet[],
+                                         const U32_T deadline[], const U32_T order[],
+                                         U64_T start, U32_T *iterations) {
+    U32_T j, oj, passes = 0;
+    U32_T oi = at(order, i);
+    U64_T an = start, anext, term;
+
+    if(wcet[oi] == 0)
+        return 0;
+
+    while(1)
+    {
+        anext = wcet[oi];
+        passes++;
+
+        for(j = 0; j < i; j++)
+        {
+            oj = at(order, j);
+            if(__builtin_mul_overflow(ceil_div64(an, period[oj]), (U64_T)wcet[oj], &term) ||
+               __builtin_add_overflow(anext, term, &anext))
+            {
+                anext = ~0ull;
+                break;
+            }
+        }
+
+        if(anext == an)
+            break;
+
+        an = anext;
+
+        if(an > deadline[oi])
+            break;
+    }
+
+    *iterations += passes;
+    return an;
+}
+
+// Lehoczky's level-i busy period, entered once the first job of level i runs past T(i) so
+// the next job is released into the backlog. Job q completes at the fixed point of
+// w(q) = (q + 1) C(i) + sum_j<i ceil(w(q)/T(j))*C(j), R(q) = w(q) - q T(i), and the window
+// closes at the first w(q) <= (q + 1) T(i). Needs the level utilization <= 1 to close.
+static U64_T rta_busy_window(U32_T i, const U32_T period[], const U32_T wcet[],
+                             const U32_T deadline[], const U32_T order[], U64_T first,
+                             U32_T *iterations) {
+    U32_T j, oj, passes = 0;
+    U32_T oi = at(order, i);
+    U64_T w = first, wnext, own, term, release, worst = first, q;
+
+    for(q = 1; w > q * period[oi] && worst <= deadline[oi]; q++)
+    {
+        release = q * period[oi];
+        if(__builtin_mul_overflow(q + 1, (U64_T)wcet[oi], &own))
+            return ~0ull;
+
+        // w(q - 1) + C(i) never overshoots w(q)
+        w += wcet[oi];
+        while(1)
+        {
+            wnext = own;
+            passes++;
+
+            for(j = 0; j < i; j++)
+            {
+                oj = at(order, j);
+                if(__builtin_mul_overflow(ceil_div64(w, period[oj]), (U64_T)wcet[oj], &term) ||
+                   __builtin_add_overflow(wnext, term, &wnext))
+                {
+                    *iterations += passes;
+                    return ~0ull;
+                }
+            }
+
+            if(wnext == w)
+                break;
+
+            w = wnext;
+
+            if(w - release > deadline[oi])
+                break;
+        }
+
+        if(w - release > worst)
+            worst = w - release;
+    }
+
+    *iterations += passes;
+    return worst;
+}
+
+U32_T response_time_service(U32_T i, const U32_T period[], const U32_T wcet[],
+                            const U32_T deadline[], U32_T start) {
+    U32_T j, an = start, anext, term, passes = 0;
+
+    if(wcet[i] == 0)
+        return 0;
+
+    // one service has no set wide range check to lean on, so every step checks for a wrap,
+    // which can only happen past a 32 bit deadline and saturates to a miss
+    while(1)
+    {
+        anext = wcet[i];
+
+        for(j = 0; j < i; j++)
+        {
+            if(__builtin_mul_overflow(ceil_div(an, period[j]), wcet[j], &term) ||
+               __builtin_add_overflow(anext, term, &anext))
+            {
+                anext = (U32_T)FEAS_U32_MAX;
+                break;
+            }
+        }
+
+        if(anext == an)
+            break;
+
+        an = anext;
+
+        if(an > deadline[i])
+            break;
+    }
+
+    // a D > T job still running at the next release, later jobs of the window can be worse
+    if(an > period[i] && an <= deadline[i])
+    {
+        // an overloaded level never closes its window, every job after some point misses
+        if(exact_util_compare(i + 1, period, wcet) > 0)
+            return (U32_T)FEAS_U32_MAX;
+        an = clamp32(rta_busy_window(i, period, wcet, deadline, NULL, an, &passes));
+    }
+
+    return an;
+}
+
+static inline int rta_levels(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                             const U32_T deadline[], const U32_T order[], U32_T resp[],
+                             U32_T *iterations) {
+    U32_T i, oi, seen, start = *iterations;
+    U32_T an = 0;
+    U64_T r;
+    int wide = !feasibility_fits_32(numServices, period, wcet, deadline);
+    FEAS_TRACE_BEGIN();
+
+    if(wide)
+        FEAS_TRACE_EVENT(FEAS_EVENT_WIDE);
+
+    // U > 1 misses under any priorities, and a D > T level would never close its busy window
+    if(exact_util_compare(numServices, period, wcet) > 0)
+    {
+        FEAS_TRACE_END(FEAS_TEST_RTA, FEAS_EXIT_MISS, numServices, 0);
+        return FALSE;
+    }
+
+    for(i = 0; i < numServices; i++)
+    {
+        oi   = at(order, i);
+        seen = *iterations;
+
+        // R(k) + C(i) for the last k < i with work never overshoots the fixed point of service i
+        if(wide)
+            r = rta_fixed_point_wide(i, period, wcet, deadline, order, (U64_T)an + wcet[oi],
+                                     iterations);
+        else
+            r = rta_fixed_point(i, period, wcet, deadline, order, an + wcet[oi], iterations);
+
+        // the first job is the worst one only if it completes by the next release
+        if(r > period[oi] && r <= deadline[oi])
+            r = rta_busy_window(i, period, wcet, deadline, order, r, iterations);
+
+        FEAS_TRACE_TASK(FEAS_TEST_RTA, *iterations - seen);
+
+        if(resp != NULL)
+            resp[oi] = clamp32(r);
+
+        if(r > deadline[oi])
+        {
+            FEAS_TRACE_END(FEAS_TEST_RTA, FEAS_EXIT_MISS, numServices, *iterations - start);
+            return FALSE;
+        }
+
+        if(wcet[oi] != 0)
+            an = (U32_T)r;
+    }
+
+    FEAS_TRACE_END(FEAS_TEST_RTA, FEAS_EXIT_FEASIBLE, numServices, *iterations - start);
+    return TRUE;
+}
+
+int response_time_analysis_count(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[], U32_T resp[], U32_T *iterations) {
+    return rta_levels(numServices, period, wcet, deadline, NULL, resp, iterations);
+}
+
+int response_time_analysis(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[], U32_T resp[]) {
+    U32_T iterations = 0;
+
+    return rta_levels(numServices, period, wcet, deadline, NULL, resp, &iterations);
+}
+
+int response_time_analysis_order(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[], const U32_T order[], U32_T resp[]) {
+    U32_T iterations = 0;
+
+    return rta_levels(numServices, period, wcet, deadline, order, resp, &iterations);
+}
+
+int completion_time_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                const U32_T deadline[]) {
+    return response_time_analysis(numServices, period, wcet, deadline, NULL);
+}
+
+// W(i, t) = sum_j<=i C(j)*ceil(t/T(j)), the level-i demand over [0, t]
+static inline U32_T level_demand(U32_T i, const U32_T period[], const U32_T wcet[],
+                                 const U32_T order[], U32_T t) {
+    U32_T j, oj, demand = 0;
+
+    for(j = 0; j <= i; j++)
+    {
+        oj      = at(order, j);
+        demand += ceil_div(t, period[oj]) * wcet[oj];
+    }
+
+    return demand;
+}
+
+// level_demand in 64 bits, saturated at the largest U64 instead of wrapping
+static inline U64_T level_demand_wide(U32_T i, const U32_T period[], const U32_T wcet[],
+                                      const U32_T order[], U32_T t) {
+    U32_T j, oj;
+    U64_T demand = 0, term;
+
+    for(j = 0; j <= i; j++)
+    {
+        oj = at(order, j);
+        if(__builtin_mul_overflow((U64_T)ceil_div(t, period[oj]), (U64_T)wcet[oj], &term) ||
+           __builtin_add_overflow(demand, term, &demand))
+            return ~0ull;
+    }
+
+    return demand;
+}
+
+// Bini and Buttazzo P(i-1)(D(i)), kept sorted and deduplicated in one half of scratch[]
+static U32_T build_points(U32_T i, const U32_T period[], const U32_T order[], U32_T horizon,
+                          U32_T floor_t, U32_T scratch[], U32_T capacity, U32_T **points) {
+    U32_T *cur = scratch, *next = scratch + capacity, *swap;
+    U32_T count = 1, merged, a, b, t, m, u, tj;
+    U32_T j = i;
+
+    cur[0] = horizon;
+
+    while(j-- > 0)
+    {
+        tj = period[at(order, j)];
+
+        // floor(t/T(j))*T(j) is monotone in t, so the mapped list is already sorted
+        a = 0; b = 0; merged = 0;
+        while(b < count)
+        {
+            m = (cur[b] / tj) * tj;
+            if(m < floor_t)
+            {
+                // nothing below the total level-i demand can ever be a scheduling point
+                b++;
+                continue;
+            }
+            while(a < count && cur[a] < m)
+            {
+                if(merged == capacity) return 0;
+                next[merged++] = cur[a++];
+            }
+            if(a < count && cur[a] == m)
+                a++;
+            if(merged == capacity) return 0;
+            next[merged++] = m;
+            // later originals can map onto the same multiple
+            while(b < count && (cur[b] / tj) * tj == m)
+                b++;
+        }
+        while(a < count)
+        {
+            if(merged == capacity) return 0;
+            next[merged++] = cur[a++];
+        }
+
+        // drop repeats left when an original equals a multiple already copied
+        for(t = 1, u = 1; t < merged; t++)
+            if(next[t] != next[u - 1])
+                next[u++] = next[t];
+
+        count = u;
+        swap = cur; cur = next; next = swap;
+    }
+
+    *points = cur;
+    return count;
+}
+
+static inline int sp_levels(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                            const U32_T deadline[], const U32_T order[], U32_T scratch[],
+                            U32_T capacity, U32_T point_out[]) {
+    U32_T i, oi, j, k, count, horizon, found, iterations = 0, visited, total = 0;
+    U64_T sum_c = 0, demand;
+    U32_T *points;
+    int wide = !feasibility_fits_32(numServices, period, wcet, deadline);
+    FEAS_TRACE_BEGIN();
+
+    if(wide)
+        FEAS_TRACE_EVENT(FEAS_EVENT_WIDE);
+
+    // For all services in the analysis
+    for(i = 0; i < numServices; i++) // iterate from highest to lowest priority
+    {
+        oi      = at(order, i);
+        sum_c  += wcet[oi];
+        horizon = (deadline[oi] < period[oi]) ? deadline[oi] : period[oi];
+        found   = 0;
+        visited = 0;
+
+        // nothing to schedule, the job is done the instant it is released
+        if(wcet[oi] == 0)
+        {
+            if(point_out != NULL)
+                point_out[oi] = 0;
+            continue;
+        }
+
+        if(sum_c <= horizon)
+        {
+            count = build_points(i, period, order, horizon, (U32_T)sum_c, scratch, capacity,
+                                 &points);
+
+            if(count == 0)
+            {
+                // point set does not fit the scratch, the completion time fixed point is the
+                // earliest instant the level-i demand is met so it answers the same question
+                FEAS_TRACE_EVENT(FEAS_EVENT_FALLBACK);
+                visited = iterations;
+                if(wide)
+                    demand = rta_fixed_point_wide(i, period, wcet, deadline, order, sum_c,
+                                                  &iterations);
+                else
+                    demand = rta_fixed_point(i, period, wcet, deadline, order, (U32_T)sum_c,
+                                             &iterations);
+                if(demand <= horizon)
+                    found = (U32_T)demand;
+                visited = iterations - visited;
+            }
+            else
+            {
+                for(k = 0; k < count; k++)
+                {
+                    if(wide)
+                        demand = level_demand_wide(i, period, wcet, order, points[k]);
+                    else
+                        demand = level_demand(i, period, wcet, order, points[k]);
+                    visited++;
+
+                    // Can we get the CPU we need or not?
+                    if(demand <= points[k])
+                    {
+                        found = points[k];
+                        break;
+                    }
+
+                    // W is monotone, so no point before the demand just seen can be satisfied
+                    for(j = k + 1; j < count && points[j] < demand; j++)
+                        ;
+                    k = j - 1;
+                }
+            }
+        }
+
+        if(point_out != NULL)
+            point_out[oi] = found;
+
+        FEAS_TRACE_TASK(FEAS_TEST_SP, visited);
+        total += visited;
+
+        // insufficient CPU during our period, therefore infeasible
+        if(found == 0)
+        {
+            FEAS_TRACE_END(FEAS_TEST_SP, (sum_c > horizon) ? FEAS_EXIT_PRUNED : FEAS_EXIT_MISS,
+                           numServices, total);
+            return FALSE;
+        }
+    }
+
+    FEAS_TRACE_END(FEAS_TEST_SP, FEAS_EXIT_FEASIBLE, numServices, total);
+    return TRUE;
+}
+
+int scheduling_point_analysis(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                              const U32_T deadline[], U32_T scratch[], U32_T capacity,
+                              U32_T point_out[]) {
+    return sp_levels(numServices, period, wcet, deadline, NULL, scratch, capacity, point_out);
+}
+
+int scheduling_point_analysis_order(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], const U32_T order[], U32_T scratch[],
+                                    U32_T capacity, U32_T point_out[]) {
+    return sp_levels(numServices, period, wcet, deadline, order, scratch, capacity, point_out);
+}
+
+// strict weak order of services a and b under the policy, ties broken by arrival index
+static inline int priority_before(U32_T a, U32_T b, const U32_T period[],
+                                  const U32_T deadline[], int priority) {
+    const U32_T *major = (priority == PRIO_DM) ? deadline : period;
+    const U32_T *minor = (priority == PRIO_DM) ? period : deadline;
+
+    if(major[a] != major[b])
+        return major[a] < major[b];
+    if(minor[a] != minor[b])
+        return minor[a] < minor[b];
+    return a < b;
+}
+
+static void order_sift(U32_T order[], U32_T root, U32_T count, const U32_T period[],
+                       const U32_T deadline[], int priority) {
+    U32_T child, top = order[root];
+
+    while((child = 2 * root + 1) < count)
+    {
+        if(child + 1 < count &&
+           priority_before(order[child], order[child + 1], period, deadline, priority))
+            child++;
+        if(!priority_before(top, order[child], period, deadline, priority))
+            break;
+        order[root] = order[child];
+        root = child;
+    }
+
+    order[root] = top;
+}
+
+void priority_order(U32_T numServices, const U32_T period[], const U32_T deadline[],
+                    int priority, U32_T order[]) {
+    U32_T i, swap;
+
+    for(i = 0; i < numServices; i++)
+        order[i] = i;
+
+    if(priority == PRIO_GIVEN || numServices < 2)
+        return;
+
+    // in place heapsort, the arrival tie break makes the order total so stability is moot
+    for(i = numServices / 2; i-- > 0; )
+        order_sift(order, i, numServices, period, deadline, priority);
+
+    for(i = numServices - 1; i > 0; i--)
+    {
+        swap     = order[0];
+        order[0] = order[i];
+        order[i] = swap;
+        order_sift(order, 0, i, period, deadline, priority);
+    }
+}
+
+int scheduling_point_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[]) {
+    U32_T scratch[2 * SCHED_POINT_STACK];
+
+    return scheduling_point_analysis(numServices, period, wcet, deadline,
+                                     scratch, SCHED_POINT_STACK, NULL);
+}
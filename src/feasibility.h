@@ -0,0 +1,166 @@
+/**
+ *  @name   feasibility
+ *  @brief  single core fixed priority feasibility kernels shared by the test driver
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Sam Siewert, see feasibility_tests.c for the original references
+*/
+
+#ifndef FEASIBILITY_H
+#define FEASIBILITY_H
+
+#define TRUE 1
+#define FALSE 0
+#define U32_T unsigned int
+#define U64_T unsigned long long
+
+// returned instead of TRUE/FALSE when a test cannot represent its horizon
+#define FEAS_OVERFLOW (-1)
+
+#define LUB_TABLE_SIZE 64
+
+/**
+ *  All kernels take the services in priority order (index 0 is the highest priority)
+ *  as separate period/wcet/deadline arrays of numServices entries. None of them print,
+ *  touch globals or keep state between calls, see report.h for the printing layer.
+*/
+int rate_monotonic_least_upper_bound(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                     const U32_T deadline[]);
+int completion_time_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                const U32_T deadline[]);
+int scheduling_point_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[]);
+
+/**
+ *  @brief  scheduling point test over the reduced Bini and Buttazzo point set
+ *
+ *  The points of service i are P(i-1)(min(D(i), T(i))), built as a sorted, deduplicated list
+ *  and pruned below C(0) + ... + C(i) where no point can ever satisfy the demand. Points are
+ *  visited in increasing order and each miss skips straight past the demand it just computed.
+ *  A point set larger than capacity falls back to the completion time fixed point.
+ *
+ *  @param  scratch     2 * capacity entries of working storage
+ *  @param  point_out   first satisfying point of each service, 0 for a C = 0 service, may be
+ *                      NULL. On failure only point_out[0..i] are written and point_out[i] = 0.
+ *
+ *  @return TRUE if every service finds a satisfying point, FALSE at the first that does not
+*/
+int scheduling_point_analysis(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                              const U32_T deadline[], U32_T scratch[], U32_T capacity,
+                              U32_T point_out[]);
+
+// point capacity scheduling_point_feasibility keeps on the stack
+#define SCHED_POINT_STACK 512
+
+/**
+ *  @brief  range check picking the 32 bit kernel over the 64 bit one
+ *
+ *  The completion time and scheduling point tests call this once per set. When it fails they
+ *  widen every demand and fixed point sum to 64 bits with overflow checks, a sum that still
+ *  overflows is past any 32 bit deadline and counts as a miss. Response times reported
+ *  through resp[] saturate at 0xFFFFFFFF. Sets of small values, which is nearly every set,
+ *  stay on the 32 bit path.
+ *
+ *  @return TRUE if, with H = max D + max C, max C + sum_j (H/T(j) + 1)*C(j) fits in 32 bits,
+ *          which bounds every intermediate of the 32 bit kernels
+*/
+int feasibility_fits_32(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                        const U32_T deadline[]);
+
+/**
+ *  @brief  sum of C(i)/T(i)
+*/
+double rm_utilization(U32_T numServices, const U32_T period[], const U32_T wcet[]);
+
+/**
+ *  @brief  exact sign of U - 1, U = sum of C(i)/T(i)
+ *
+ *  The double sum decides every set outside its rounding error, the rest are summed as one
+ *  fraction, see exact.h. U = 1 sets are never decided by rounding.
+ *
+ *  @return -1 if U < 1, 0 if U == 1, 1 if U > 1
+*/
+int utilization_compare_one(U32_T numServices, const U32_T period[], const U32_T wcet[]);
+
+/**
+ *  @brief  Liu and Layland bound n(2^(1/n) - 1), table lookup for n <= LUB_TABLE_SIZE
+*/
+double rm_lub_bound(U32_T numServices);
+
+/**
+ *  @brief  integer response time analysis (Joseph and Pandya completion test)
+ *
+ *  Iterates R(i) = C(i) + sum_j<i ceil(R(i)/T(j))*C(j) with exact integer ceilings.
+ *  Task i+1 starts from R(i) + C(i+1), which is a lower bound on its response time,
+ *  and the iteration stops as soon as R exceeds D. A service with D > T whose first job
+ *  runs past T has every job of its level-i busy period analyzed (Lehoczky), R(i) is the
+ *  worst of them. U > 1 is rejected before any fixed point runs.
+ *
+ *  @param  resp    filled with the converged response time of each service, may be NULL.
+ *                  On a deadline miss only resp[0..i] are written, resp[i] > deadline[i].
+ *                  Nothing is written when U > 1.
+ *
+ *  @return TRUE if every service meets its deadline, FALSE at the first miss
+*/
+int response_time_analysis(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[], U32_T resp[]);
+
+/**
+ *  @brief  response_time_analysis that also adds the fixed point iterations it ran to *iterations
+*/
+int response_time_analysis_count(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[], U32_T resp[], U32_T *iterations);
+
+/**
+ *  @brief  fixed point iteration for service i alone
+ *
+ *  The set is never range checked as a whole, so every sum is overflow checked instead.
+ *  A first job that runs past T(i) continues with the busy window as in
+ *  response_time_analysis, and a level whose utilization exceeds 1 is a miss.
+ *
+ *  @param  start   any lower bound on the first job's R(i), C(0) + ... + C(i) always works
+ *
+ *  @return R(i), 0 when C(i) = 0, or the first iterate past deadline[i] if the service misses,
+ *          saturated at 0xFFFFFFFF when that iterate does not fit 32 bits
+*/
+U32_T response_time_service(U32_T i, const U32_T period[], const U32_T wcet[],
+                            const U32_T deadline[], U32_T start);
+
+// priority assignments understood by priority_order
+#define PRIO_GIVEN  0   // index order, the arrays are already highest priority first
+#define PRIO_RM     1   // rate monotonic, shortest period first, then shortest deadline
+#define PRIO_DM     2   // deadline monotonic, shortest deadline first, then shortest period
+
+/**
+ *  @brief  sort service indices once into priority order without touching the task arrays
+ *
+ *  Ties that survive both keys keep their arrival (index) order.
+ *
+ *  @param  order   numServices entries, order[k] is the index of the service at level k
+*/
+void priority_order(U32_T numServices, const U32_T period[], const U32_T deadline[],
+                    int priority, U32_T order[]);
+
+/**
+ *  @brief  response_time_analysis over the services taken in the level order of order[]
+ *
+ *  Any fixed priority assignment works, e.g. priority_order output for DM or an explicit
+ *  order read from the input. The caller's arrays are indexed through order[], never copied.
+ *
+ *  @param  resp    indexed like the caller's arrays, resp[order[k]] is R of level k
+*/
+int response_time_analysis_order(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                 const U32_T deadline[], const U32_T order[], U32_T resp[]);
+
+/**
+ *  @brief  scheduling_point_analysis over the services taken in the level order of order[]
+ *
+ *  @param  point_out   indexed like the caller's arrays, may be NULL
+*/
+int scheduling_point_analysis_order(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], const U32_T order[], U32_T scratch[],
+                                    U32_T capacity, U32_T point_out[]);
+
+#endif
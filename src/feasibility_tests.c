@@ -1,377 +1,1159 @@
-/**
- *  @name   feasibility_tests
- *  @brief  runs a suite of scheduling feasibility tests on 10 discrete examples
- * 
- *  @author Mark Sherman
- *  @date   02/22/2024
- * 
- *  @cite   original by Sam Siewert, see comment below
-*/
-
-// Sam Siewert, August 2020
-//
-// This example code provides feasibiltiy decision tests for single core fixed priority rate monontic systems only (not dyanmic priority such as deadline driven
-// EDF and LLF).  These are standard algorithms which either estimate feasibility (as the RM LUB does) or automate exact analysis (scheduling point, completion test) for
-// a set services sharing one CPU core.  This can be emulated on Linux SMP multi-core systemes by use of POSIX thread affinity, to "pin" a thread to a specific core.
-//
-// Coded based upon standard definition of:
-//
-// 1) RM LUB based upon model by Liu and Layland
-// 2) Scheduling Point - an exact feasibility algorithm based upon Lehoczky, Sha, and Ding exact analysis
-// 3) Completion Test - an exact feasibility algorithm
-//
-// All 3 are also covered in RTECS with Linux and RTOS p. 84 to p. 89
-//
-// Original references for single core AMP systems:
-//
-// 1) RM LUB - Liu, Chung Laung, and James W. Layland. "Scheduling algorithms for multiprogramming in a hard-real-time environment." Journal of the ACM (JACM) 20.1 (1973): 46-61.
-// 2) Scheduling Point - Lehoczky, John, Lui Sha, and Yuqin Ding. "The rate monotonic scheduling algorithm: Exact characterization and average case behavior." RTSS. Vol. 89. 1989.
-// 3) Completion Test - Joseph, Mathai, and Paritosh Pandya. "Finding response times in a real-time system." The Computer Journal 29.5 (1986): 390-395.
-//
-// References for mulit-core systems:
-//
-// 1) Bertossi, Alan A., Luigi V. Mancini, and Federico Rossini. "Fault-tolerant rate-monotonic first-fit scheduling in hard-real-time systems."
-//    IEEE Transactions on Parallel and Distributed Systems 10.9 (1999): 934-945.
-// 2) Burchard, Almut, et al. "New strategies for assigning real-time tasks to multiprocessor systems." IEEE transactions on computers 44.12 (1995): 1429-1442.
-// 3) Dhall, Sudarshan K., and Chung Laung Liu. "On a real-time scheduling problem." Operations research 26.1 (1978): 127-140.
-//
-//
-// Deadline Montonic (not implemented in this example, but covered in class and notes):
-//
-// 1) Audsley, Neil C., et al. "Hard real-time scheduling: The deadline-monotonic approach." IFAC Proceedings Volumes 24.2 (1991): 127-132.
-//
-// Note that Deadline Monotoic simply uses the deadine interval, D(i) to assign priority, rather than the period interval, T(i) and relaxes T=D constraint.  Anlaysis can
-// be done as it is done for RM, but with evaluation of feasbility based upon modified D(i) and with modified fixed priorities.  This is covered by manual analysis examples.
-//
-// For a more interactive tool, students can use Cheddar:
-//
-// http://beru.univ-brest.fr/~singhoff/cheddar/
-//
-// This open source tool handles single and multi-core and allows for modeling of the platform hardware, RTOS/OS, and scheduler with a particular fixed priority or dynamic
-// priority policy.
-//
-// This code is provided primarily so students can learn the methods of worst case analysis and compare exact and estimated feasibility decision testing.
-//
-
-#include <math.h>
-#include <stdio.h>
-
-#define TRUE 1
-#define FALSE 0
-#define U32_T unsigned int
-
-// U=0.7333
-U32_T ex0_period[] = {2, 10, 15};
-U32_T ex0_wcet[] = {1, 1, 2};
-
-// U=0.9857
-U32_T ex1_period[] = {2, 5, 7};
-U32_T ex1_wcet[] = {1, 1, 2};
-
-// U=0.9967
-U32_T ex2_period[] = {2, 5, 7, 13};
-U32_T ex2_wcet[] = {1, 1, 1, 2};
-
-// U=0.93
-U32_T ex3_period[] = {3, 5, 15};
-U32_T ex3_wcet[] = {1, 2, 3};
-
-// U=1.0
-U32_T ex4_period[]  = {2, 4, 16};
-U32_T ex4_wcet[]    = {1, 1, 4};
-
-U32_T ex5_period[]  = {2, 5, 10};
-U32_T ex5_wcet[]    = {1, 2, 1};
-
-U32_T ex6_period[]  = {2, 5, 7, 13};
-U32_T ex6_wcet[]    = {1, 1, 1, 2};
-
-U32_T ex7_period[]  = {3, 5, 15};
-U32_T ex7_wcet[]    = {1, 2, 4};
-
-U32_T ex8_period[]  = {2, 5, 7, 13};
-U32_T ex8_wcet[]    = {1, 1, 1, 2};
-
-U32_T ex9_period[]  = {6, 8, 12, 24};
-U32_T ex9_wcet[]    = {1, 2, 4, 6};
-
-int rate_monotonic_least_upper_bound(U32_T numServices, U32_T period[], U32_T wcet[], U32_T deadline[]) {
-  double utility_sum=0.0, lub=0.0;
-  int idx;
-  // Sum the C(i) over the T(i)
-  for(idx=0; idx < numServices; idx++)
-  {
-    utility_sum += ((double)wcet[idx] / (double)period[idx]);
-    printf("\tS%d, wcet=%.4lf, period=%.4lf, utility_sum = %.4lf\n", idx, (double)wcet[idx], (double)period[idx], utility_sum);
-  }
-  printf("\tSystem Utilization = %.4lf\n", utility_sum);
-
-  // Compute LUB for number of services
-  lub = (double)numServices * (pow(2.0, (1.0/((double)numServices))) - 1.0);
-  printf("\tLUB = %.4lf\n", lub);
-
-  // Compare the utilty to the bound and return feasibility
-  if(utility_sum <= lub)
-	  return TRUE;
-  else
-	  return FALSE;
-}
-
-int completion_time_feasibility(U32_T numServices, U32_T period[], U32_T wcet[], U32_T deadline[]) {
-  int i, j;
-  U32_T an, anext;
-  
-  // assume feasible until we find otherwise
-  int set_feasible=TRUE;
-   
-  //printf("numServices=%d\n", numServices);
- 
-  // For all services in the analysis 
-  for (i=0; i < numServices; i++)
-  {
-       an=0; anext=0;
-       
-       for (j=0; j <= i; j++)
-       {
-           an+=wcet[j];
-       }
-       
-	   //printf("i=%d, an=%d\n", i, an);
-
-       while(1)
-       {
-             anext=wcet[i];
-	     
-             for (j=0; j < i; j++)
-                 anext += ceil(((double)an)/((double)period[j]))*wcet[j];
-		 
-             if (anext == an)
-                break;
-             else
-                an=anext;
-
-			 //printf("an=%d, anext=%d\n", an, anext);
-       }
-       
-	   //printf("an=%d, deadline[%d]=%d\n", an, i, deadline[i]);
-
-       if (an > deadline[i])
-       {
-          set_feasible=FALSE;
-       }
-  }
-  
-  return set_feasible;
-}
-
-int scheduling_point_feasibility(U32_T numServices, U32_T period[], U32_T wcet[], U32_T deadline[]) {
-   int rc = TRUE, i, j, k, l, status, temp;
-
-   // For all services in the analysis
-   for (i=0; i < numServices; i++) // iterate from highest to lowest priority
-   {
-      status=0;
-
-      // Look for all available CPU minus what has been used by higher priority services
-      for (k=0; k<=i; k++) 
-      {
-	  // find available CPU windows and take them
-          for (l=1; l <= (floor((double)period[i]/(double)period[k])); l++)
-          {
-               temp=0;
-
-               for (j=0; j<=i; j++) temp += wcet[j] * ceil((double)l*(double)period[k]/(double)period[j]);
-
-	       // Can we get the CPU we need or not?
-               if (temp <= (l*period[k]))
-			   {
-				   // insufficient CPU during our period, therefore infeasible
-				   status=1;
-				   break;
-			   }
-           }
-           if (status) break;
-      }
-
-      if (!status) rc=FALSE;
-   }
-   return rc;
-}
-
-void print_test_results(U32_T numServices, U32_T period[], U32_T wcet[], double util) {
-
-    printf("\nCompletion Time:  ");
-    if(completion_time_feasibility(numServices, period, wcet, period) == TRUE)
-        printf("FEASIBLE\n");
-    else
-        printf("INFEASIBLE\n");
-
-    printf("Scheduling Point: ");
-    if(scheduling_point_feasibility(numServices, period, wcet, period) == TRUE)
-        printf("FEASIBLE\n\n");
-    else
-        printf("INFEASIBLE\n\n");
-
-    if(rate_monotonic_least_upper_bound(numServices, period, wcet, period) == TRUE)
-        printf("\nRM LUB: FEASIBLE\n");
-    else
-        printf("\nRM LUB: INFEASIBLE\n");
-
-    printf("EDF: \t");
-    if(util <= 100)
-        printf("FEASIBLE\n");
-    else
-        printf("INFEASIBLE\n");
-
-    printf("LLF: \t");
-    if(util <= 100)
-        printf("FEASIBLE\n");
-    else
-        printf("INFEASIBLE\n");
-}
-
-int main(void) { 
-    double utilization  = 0;
-	U32_T numServices   = 0;
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex0_wcet[0]/(double)ex0_period[0]) * 100) +
-                            (double)((double)(ex0_wcet[1]/(double)ex0_period[1]) * 100) +
-                            (double)(((double)ex0_wcet[2]/(double)ex0_period[2]) * 100));
-    numServices = 3;
-
-    printf("************************************************************************\n");
-    printf("Ex-0 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
-            utilization, ex0_wcet[0], ex0_wcet[1], ex0_wcet[2], 
-            ex0_period[0], ex0_period[1], ex0_period[2]);
-
-    print_test_results(numServices, ex0_period, ex0_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex1_wcet[0]/(double)ex1_period[0]) * 100) +
-                            (double)((double)(ex1_wcet[1]/(double)ex1_period[1]) * 100) +
-                            (double)(((double)ex1_wcet[2]/(double)ex1_period[2]) * 100));
-    numServices = 3;
-
-    printf("************************************************************************\n");
-    printf("Ex-1 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
-            utilization, ex1_wcet[0], ex1_wcet[1], ex1_wcet[2], 
-            ex1_period[0], ex1_period[1], ex1_period[2]);
-
-    print_test_results(numServices, ex1_period, ex1_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex2_wcet[0]/(double)ex2_period[0]) * 100) +
-                            (double)((double)(ex2_wcet[1]/(double)ex2_period[1]) * 100) +
-                            (double)(((double)ex2_wcet[2]/(double)ex2_period[2]) * 100) +
-                            (double)(((double)ex2_wcet[3]/(double)ex2_period[3]) * 100));
-    numServices = 4;
-
-    printf("************************************************************************\n");
-    printf("Ex-2 U=%4.2f\% (C1=%d, C2=%d, C3=%d, C4=%d; T1=%d, T2=%d, T3=%d, T4=%d; T=D)",
-            utilization, ex2_wcet[0], ex2_wcet[1], ex2_wcet[2], ex2_wcet[3],
-            ex2_period[0], ex2_period[1], ex2_period[2], ex2_period[3]);
-
-    print_test_results(numServices, ex2_period, ex2_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex3_wcet[0]/(double)ex3_period[0]) * 100) +
-                            (double)((double)(ex3_wcet[1]/(double)ex3_period[1]) * 100) +
-                            (double)(((double)ex3_wcet[2]/(double)ex3_period[2]) * 100));
-    numServices = 3;
-
-    printf("************************************************************************\n");
-    printf("Ex-3 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
-            utilization, ex3_wcet[0], ex3_wcet[1], ex3_wcet[2], 
-            ex3_period[0], ex3_period[1], ex3_period[2]);
-
-    print_test_results(numServices, ex3_period, ex3_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex4_wcet[0]/(double)ex4_period[0]) * 100) +
-                            (double)((double)(ex4_wcet[1]/(double)ex4_period[1]) * 100) +
-                            (double)(((double)ex4_wcet[2]/(double)ex4_period[2]) * 100));
-    numServices = 3;
-
-    printf("************************************************************************\n");
-    printf("Ex-4 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
-            utilization, ex4_wcet[0], ex4_wcet[1], ex4_wcet[2], 
-            ex4_period[0], ex4_period[1], ex4_period[2]);
-
-    print_test_results(numServices, ex4_period, ex4_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex5_wcet[0]/(double)ex5_period[0]) * 100) +
-                            (double)((double)(ex5_wcet[1]/(double)ex5_period[1]) * 100) +
-                            (double)(((double)ex5_wcet[2]/(double)ex5_period[2]) * 100));
-    numServices = 3;
-
-    printf("************************************************************************\n");
-    printf("Ex-5 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
-            utilization, ex5_wcet[0], ex5_wcet[1], ex5_wcet[2], 
-            ex5_period[0], ex5_period[1], ex5_period[2]);
-
-    print_test_results(numServices, ex5_period, ex5_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex6_wcet[0]/(double)ex6_period[0]) * 100) +
-                            (double)((double)(ex6_wcet[1]/(double)ex6_period[1]) * 100) +
-                            (double)((double)(ex6_wcet[2]/(double)ex6_period[2]) * 100) +
-                            (double)(((double)ex6_wcet[3]/(double)ex6_period[3]) * 100));
-    numServices = 4;
-    printf("************************************************************************\n");
-    printf("Ex-6 U=%4.2f\% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D): ",
-            utilization, ex6_wcet[0], ex6_wcet[1], ex6_wcet[2], ex6_wcet[3],
-            ex6_period[0], ex6_period[1], ex6_period[2], ex6_period[3]);
-
-    print_test_results(numServices, ex6_period, ex6_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex7_wcet[0]/(double)ex7_period[0]) * 100) +
-                            (double)((double)(ex7_wcet[1]/(double)ex7_period[1]) * 100) +
-                            (double)(((double)ex7_wcet[2]/(double)ex7_period[2]) * 100));
-    numServices = 3;
-    printf("************************************************************************\n");
-    printf("Ex-7 U=%4.2f\% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D): ",
-            utilization, ex7_wcet[0], ex7_wcet[1], ex7_wcet[2],
-            ex7_period[0], ex7_period[1], ex7_period[2]);
-
-    print_test_results(numServices, ex7_period, ex7_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex8_wcet[0]/(double)ex8_period[0]) * 100) +
-                            (double)((double)(ex8_wcet[1]/(double)ex8_period[1]) * 100) +
-                            (double)((double)(ex8_wcet[2]/(double)ex8_period[2]) * 100) +
-                            (double)((double)(ex8_wcet[3]/(double)ex8_period[3]) * 100));
-    numServices = 4;
-    printf("************************************************************************\n");
-    printf("Ex-8 U=%4.2f\% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D): ",
-            utilization, ex8_wcet[0], ex8_wcet[1], ex8_wcet[2], ex8_wcet[3],
-            ex8_period[0], ex8_period[1], ex8_period[2], ex8_period[3]);
-
-    print_test_results(numServices, ex8_period, ex8_wcet, utilization);
-/*****************************************************************************************************************/
-
-/*****************************************************************************************************************/
-    utilization = (double) ((double)((double)(ex9_wcet[0]/(double)ex9_period[0]) * 100) +
-                            (double)((double)(ex9_wcet[1]/(double)ex9_period[1]) * 100) +
-                            (double)((double)(ex9_wcet[2]/(double)ex9_period[2]) * 100) +
-                            (double)((double)(ex9_wcet[3]/(double)ex9_period[3]) * 100));
-    numServices = 4;    
-    printf("************************************************************************\n");
-    printf("Ex-9 U=%4.2f\% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D)",
-            utilization, ex9_wcet[0], ex9_wcet[1], ex9_wcet[2], ex9_wcet[3],
-            ex9_period[0], ex9_period[1], ex9_period[2], ex9_period[3]);
-
-    print_test_results(numServices, ex9_period, ex9_wcet, utilization);
-    printf("************************************************************************\n");
-/*****************************************************************************************************************/
-}
+/**
+ *  @name   feasibility_tests
+ *  @brief  runs a suite of scheduling feasibility tests on 10 discrete examples
+ * 
+ *  @author Mark Sherman
+ *  @date   02/22/2024
+ * 
+ *  @cite   original by Sam Siewert, see comment below
+*/
+
+// Sam Siewert, August 2020
+//
+// This example code provides feasibiltiy decision tests for single core fixed priority rate monontic systems only (not dyanmic priority such as deadline driven
+// EDF and LLF).  These are standard algorithms which either estimate feasibility (as the RM LUB does) or automate exact analysis (scheduling point, completion test) for
+// a set services sharing one CPU core.  This can be emulated on Linux SMP multi-core systemes by use of POSIX thread affinity, to "pin" a thread to a specific core.
+//
+// Coded based upon standard definition of:
+//
+// 1) RM LUB based upon model by Liu and Layland
+// 2) Scheduling Point - an exact feasibility algorithm based upon Lehoczky, Sha, and Ding exact analysis
+// 3) Completion Test - an exact feasibility algorithm
+//
+// All 3 are also covered in RTECS with Linux and RTOS p. 84 to p. 89
+//
+// Original references for single core AMP systems:
+//
+// 1) RM LUB - Liu, Chung Laung, and James W. Layland. "Scheduling algorithms for multiprogramming in a hard-real-time environment." Journal of the ACM (JACM) 20.1 (1973): 46-61.
+// 2) Scheduling Point - Lehoczky, John, Lui Sha, and Yuqin Ding. "The rate monotonic scheduling algorithm: Exact characterization and average case behavior." RTSS. Vol. 89. 1989.
+// 3) Completion Test - Joseph, Mathai, and Paritosh Pandya. "Finding response times in a real-time system." The Computer Journal 29.5 (1986): 390-395.
+//
+// References for mulit-core systems:
+//
+// 1) Bertossi, Alan A., Luigi V. Mancini, and Federico Rossini. "Fault-tolerant rate-monotonic first-fit scheduling in hard-real-time systems."
+//    IEEE Transactions on Parallel and Distributed Systems 10.9 (1999): 934-945.
+// 2) Burchard, Almut, et al. "New strategies for assigning real-time tasks to multiprocessor systems." IEEE transactions on computers 44.12 (1995): 1429-1442.
+// 3) Dhall, Sudarshan K., and Chung Laung Liu. "On a real-time scheduling problem." Operations research 26.1 (1978): 127-140.
+//
+//
+// Deadline Montonic (not implemented in this example, but covered in class and notes):
+//
+// 1) Audsley, Neil C., et al. "Hard real-time scheduling: The deadline-monotonic approach." IFAC Proceedings Volumes 24.2 (1991): 127-132.
+//
+// Note that Deadline Monotoic simply uses the deadine interval, D(i) to assign priority, rather than the period interval, T(i) and relaxes T=D constraint.  Anlaysis can
+// be done as it is done for RM, but with evaluation of feasbility based upon modified D(i) and with modified fixed priorities.  This is covered by manual analysis examples.
+//
+// For a more interactive tool, students can use Cheddar:
+//
+// http://beru.univ-brest.fr/~singhoff/cheddar/
+//
+// This open source tool handles single and multi-core and allows for modeling of the platform hardware, RTOS/OS, and scheduler with a particular fixed priority or dynamic
+// priority policy.
+//
+// This code is provided primarily so students can learn the methods of worst case analysis and compare exact and estimated feasibility decision testing.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cache.h"
+#include "corpus.h"
+#include "feasibility.h"
+#include "generator.h"
+#include "instrument.h"
+#include "loader.h"
+#include "parallel.h"
+#include "partition.h"
+#include "pool.h"
+#include "report.h"
+#include "sensitivity.h"
+#include "server.h"
+#include "sink.h"
+#include "sim.h"
+#include "small.h"
+#include "sweep.h"
+#include "workspace.h"
+
+// sets parsed and analyzed per round trip through the loader
+#define STREAM_CHUNK    4096
+
+// timeline slices kept per simulated set, longer schedules are cut off in the report
+#define SIM_TIMELINE    1024
+
+// -s policy, or -1 to skip the simulator
+static int simPolicy = -1;
+
+// -p priority order for the exact fixed priority tests, -m cores and -f heuristic for the
+// global and partitioned tests, which are skipped while numCores is 0
+static batch_config_t batchConfig = { .priority = PRIO_GIVEN, .multicore = BATCH_GLOBAL | BATCH_PARTITIONED,
+                                      .fit = PART_FIRST_FIT };
+
+// the batch only keeps the partitioned verdict, the printed core map is packed once more here
+static partition_t partition;
+static U32_T *partMap = NULL;
+static U32_T partMapSize = 0;
+
+// -o record format, or -1 for the report lines, with the response time column it needs
+static int sinkFormat = -1;
+static result_sink_t sink;
+static U32_T *respBuf = NULL;
+static U32_T respBufSize = 0;
+
+// -k memo of single core verdicts, persisted to -K across runs
+static feas_cache_t cache;
+
+// sets settled by each cascade stage, summed over every chunk for -t
+static U64_T stageCounts[BATCH_STAGE_COUNT];
+
+// one scratch workspace per -j worker, kept across chunks, the first also backs the simulator
+static feas_workspace_t *workspaces = NULL;
+
+// -x sensitivity search, its services in -p order and their scratch, 10 entries per service
+static int sensitivity = FALSE;
+static U32_T *sensBuf = NULL;
+static U32_T sensBufSize = 0;
+
+// every example once, as T1, C1, T2, C2, ... pairs, expanded into both the arrays the report
+// reads and the compile time check below
+// U=0.7333
+#define EX0_SET     2, 1, 10, 1, 15, 2
+// U=0.9857
+#define EX1_SET     2, 1, 5, 1, 7, 2
+// U=0.9967
+#define EX2_SET     2, 1, 5, 1, 7, 1, 13, 2
+// U=0.93
+#define EX3_SET     3, 1, 5, 2, 15, 3
+// U=1.0
+#define EX4_SET     2, 1, 4, 1, 16, 4
+#define EX5_SET     2, 1, 5, 2, 10, 1
+#define EX6_SET     2, 1, 5, 1, 7, 1, 13, 2
+#define EX7_SET     3, 1, 5, 2, 15, 4
+#define EX8_SET     2, 1, 5, 1, 7, 1, 13, 2
+#define EX9_SET     6, 1, 8, 2, 12, 4, 24, 6
+
+// m applied to the pairs of a set, the extra level expands the set before m sees it
+#define EX_APPLY(m, set)                            m(set)
+#define EX_PERIOD3(T0, C0, T1, C1, T2, C2)          { T0, T1, T2 }
+#define EX_WCET3(T0, C0, T1, C1, T2, C2)            { C0, C1, C2 }
+#define EX_PERIOD4(T0, C0, T1, C1, T2, C2, T3, C3)  { T0, T1, T2, T3 }
+#define EX_WCET4(T0, C0, T1, C1, T2, C2, T3, C3)    { C0, C1, C2, C3 }
+
+U32_T ex0_period[]  = EX_APPLY(EX_PERIOD3, EX0_SET);
+U32_T ex0_wcet[]    = EX_APPLY(EX_WCET3, EX0_SET);
+
+U32_T ex1_period[]  = EX_APPLY(EX_PERIOD3, EX1_SET);
+U32_T ex1_wcet[]    = EX_APPLY(EX_WCET3, EX1_SET);
+
+U32_T ex2_period[]  = EX_APPLY(EX_PERIOD4, EX2_SET);
+U32_T ex2_wcet[]    = EX_APPLY(EX_WCET4, EX2_SET);
+
+U32_T ex3_period[]  = EX_APPLY(EX_PERIOD3, EX3_SET);
+U32_T ex3_wcet[]    = EX_APPLY(EX_WCET3, EX3_SET);
+
+U32_T ex4_period[]  = EX_APPLY(EX_PERIOD3, EX4_SET);
+U32_T ex4_wcet[]    = EX_APPLY(EX_WCET3, EX4_SET);
+
+U32_T ex5_period[]  = EX_APPLY(EX_PERIOD3, EX5_SET);
+U32_T ex5_wcet[]    = EX_APPLY(EX_WCET3, EX5_SET);
+
+U32_T ex6_period[]  = EX_APPLY(EX_PERIOD4, EX6_SET);
+U32_T ex6_wcet[]    = EX_APPLY(EX_WCET4, EX6_SET);
+
+U32_T ex7_period[]  = EX_APPLY(EX_PERIOD3, EX7_SET);
+U32_T ex7_wcet[]    = EX_APPLY(EX_WCET3, EX7_SET);
+
+U32_T ex8_period[]  = EX_APPLY(EX_PERIOD4, EX8_SET);
+U32_T ex8_wcet[]    = EX_APPLY(EX_WCET4, EX8_SET);
+
+U32_T ex9_period[]  = EX_APPLY(EX_PERIOD4, EX9_SET);
+U32_T ex9_wcet[]    = EX_APPLY(EX_WCET4, EX9_SET);
+
+// the completion test verdict of every example, checked at compile time so an edited example
+// that changes its verdict fails the build instead of the printed table
+_Static_assert( EX_APPLY(SMALL_RM3, EX0_SET),   "Ex-0 must be feasible");
+_Static_assert(!EX_APPLY(SMALL_RM3, EX1_SET),   "Ex-1 must be infeasible");
+_Static_assert(!EX_APPLY(SMALL_RM4, EX2_SET),   "Ex-2 must be infeasible");
+_Static_assert( EX_APPLY(SMALL_RM3, EX3_SET),   "Ex-3 must be feasible");
+_Static_assert( EX_APPLY(SMALL_RM3, EX4_SET),   "Ex-4 must be feasible");
+_Static_assert( EX_APPLY(SMALL_RM3, EX5_SET),   "Ex-5 must be feasible");
+_Static_assert(!EX_APPLY(SMALL_RM4, EX6_SET),   "Ex-6 must be infeasible");
+_Static_assert( EX_APPLY(SMALL_RM3, EX7_SET),   "Ex-7 must be feasible");
+_Static_assert(!EX_APPLY(SMALL_RM4, EX8_SET),   "Ex-8 must be infeasible");
+_Static_assert( EX_APPLY(SMALL_RM4, EX9_SET),   "Ex-9 must be feasible");
+
+static void run_examples(void) {
+    double utilization  = 0;
+	U32_T numServices   = 0;
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex0_wcet[0]/(double)ex0_period[0]) * 100) +
+                            (double)((double)(ex0_wcet[1]/(double)ex0_period[1]) * 100) +
+                            (double)(((double)ex0_wcet[2]/(double)ex0_period[2]) * 100));
+    numServices = 3;
+
+    printf("************************************************************************\n");
+    printf("Ex-0 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
+            utilization, ex0_wcet[0], ex0_wcet[1], ex0_wcet[2], 
+            ex0_period[0], ex0_period[1], ex0_period[2]);
+
+    print_test_results(numServices, ex0_period, ex0_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex1_wcet[0]/(double)ex1_period[0]) * 100) +
+                            (double)((double)(ex1_wcet[1]/(double)ex1_period[1]) * 100) +
+                            (double)(((double)ex1_wcet[2]/(double)ex1_period[2]) * 100));
+    numServices = 3;
+
+    printf("************************************************************************\n");
+    printf("Ex-1 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
+            utilization, ex1_wcet[0], ex1_wcet[1], ex1_wcet[2], 
+            ex1_period[0], ex1_period[1], ex1_period[2]);
+
+    print_test_results(numServices, ex1_period, ex1_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex2_wcet[0]/(double)ex2_period[0]) * 100) +
+                            (double)((double)(ex2_wcet[1]/(double)ex2_period[1]) * 100) +
+                            (double)(((double)ex2_wcet[2]/(double)ex2_period[2]) * 100) +
+                            (double)(((double)ex2_wcet[3]/(double)ex2_period[3]) * 100));
+    numServices = 4;
+
+    printf("************************************************************************\n");
+    printf("Ex-2 U=%4.2f%% (C1=%d, C2=%d, C3=%d, C4=%d; T1=%d, T2=%d, T3=%d, T4=%d; T=D)",
+            utilization, ex2_wcet[0], ex2_wcet[1], ex2_wcet[2], ex2_wcet[3],
+            ex2_period[0], ex2_period[1], ex2_period[2], ex2_period[3]);
+
+    print_test_results(numServices, ex2_period, ex2_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex3_wcet[0]/(double)ex3_period[0]) * 100) +
+                            (double)((double)(ex3_wcet[1]/(double)ex3_period[1]) * 100) +
+                            (double)(((double)ex3_wcet[2]/(double)ex3_period[2]) * 100));
+    numServices = 3;
+
+    printf("************************************************************************\n");
+    printf("Ex-3 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
+            utilization, ex3_wcet[0], ex3_wcet[1], ex3_wcet[2], 
+            ex3_period[0], ex3_period[1], ex3_period[2]);
+
+    print_test_results(numServices, ex3_period, ex3_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex4_wcet[0]/(double)ex4_period[0]) * 100) +
+                            (double)((double)(ex4_wcet[1]/(double)ex4_period[1]) * 100) +
+                            (double)(((double)ex4_wcet[2]/(double)ex4_period[2]) * 100));
+    numServices = 3;
+
+    printf("************************************************************************\n");
+    printf("Ex-4 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
+            utilization, ex4_wcet[0], ex4_wcet[1], ex4_wcet[2], 
+            ex4_period[0], ex4_period[1], ex4_period[2]);
+
+    print_test_results(numServices, ex4_period, ex4_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex5_wcet[0]/(double)ex5_period[0]) * 100) +
+                            (double)((double)(ex5_wcet[1]/(double)ex5_period[1]) * 100) +
+                            (double)(((double)ex5_wcet[2]/(double)ex5_period[2]) * 100));
+    numServices = 3;
+
+    printf("************************************************************************\n");
+    printf("Ex-5 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D)",
+            utilization, ex5_wcet[0], ex5_wcet[1], ex5_wcet[2], 
+            ex5_period[0], ex5_period[1], ex5_period[2]);
+
+    print_test_results(numServices, ex5_period, ex5_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex6_wcet[0]/(double)ex6_period[0]) * 100) +
+                            (double)((double)(ex6_wcet[1]/(double)ex6_period[1]) * 100) +
+                            (double)((double)(ex6_wcet[2]/(double)ex6_period[2]) * 100) +
+                            (double)(((double)ex6_wcet[3]/(double)ex6_period[3]) * 100));
+    numServices = 4;
+    printf("************************************************************************\n");
+    printf("Ex-6 U=%4.2f%% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D): ",
+            utilization, ex6_wcet[0], ex6_wcet[1], ex6_wcet[2], ex6_wcet[3],
+            ex6_period[0], ex6_period[1], ex6_period[2], ex6_period[3]);
+
+    print_test_results(numServices, ex6_period, ex6_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex7_wcet[0]/(double)ex7_period[0]) * 100) +
+                            (double)((double)(ex7_wcet[1]/(double)ex7_period[1]) * 100) +
+                            (double)(((double)ex7_wcet[2]/(double)ex7_period[2]) * 100));
+    numServices = 3;
+    printf("************************************************************************\n");
+    printf("Ex-7 U=%4.2f%% (C1=%d, C2=%d, C3=%d; T1=%d, T2=%d, T3=%d; T=D): ",
+            utilization, ex7_wcet[0], ex7_wcet[1], ex7_wcet[2],
+            ex7_period[0], ex7_period[1], ex7_period[2]);
+
+    print_test_results(numServices, ex7_period, ex7_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex8_wcet[0]/(double)ex8_period[0]) * 100) +
+                            (double)((double)(ex8_wcet[1]/(double)ex8_period[1]) * 100) +
+                            (double)((double)(ex8_wcet[2]/(double)ex8_period[2]) * 100) +
+                            (double)((double)(ex8_wcet[3]/(double)ex8_period[3]) * 100));
+    numServices = 4;
+    printf("************************************************************************\n");
+    printf("Ex-8 U=%4.2f%% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D): ",
+            utilization, ex8_wcet[0], ex8_wcet[1], ex8_wcet[2], ex8_wcet[3],
+            ex8_period[0], ex8_period[1], ex8_period[2], ex8_period[3]);
+
+    print_test_results(numServices, ex8_period, ex8_wcet);
+/*****************************************************************************************************************/
+
+/*****************************************************************************************************************/
+    utilization = (double) ((double)((double)(ex9_wcet[0]/(double)ex9_period[0]) * 100) +
+                            (double)((double)(ex9_wcet[1]/(double)ex9_period[1]) * 100) +
+                            (double)((double)(ex9_wcet[2]/(double)ex9_period[2]) * 100) +
+                            (double)((double)(ex9_wcet[3]/(double)ex9_period[3]) * 100));
+    numServices = 4;    
+    printf("************************************************************************\n");
+    printf("Ex-9 U=%4.2f%% (C1=%d, C2=%d, C3=%d C4=%d; T1=%d, T2=%d, T3=%d T4=%d; T=D)",
+            utilization, ex9_wcet[0], ex9_wcet[1], ex9_wcet[2], ex9_wcet[3],
+            ex9_period[0], ex9_period[1], ex9_period[2], ex9_period[3]);
+
+    print_test_results(numServices, ex9_period, ex9_wcet);
+    printf("************************************************************************\n");
+/*****************************************************************************************************************/
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s                      run the built in Ex-0 to Ex-9 examples\n"
+                    "       %s [-b] [-j threads] [-p order] [-s policy] [-m cores [-f fit]] [-x] [-C] [-t] [-o format] [-k entries] [-K file] [file | -]\n"
+                    "       %s [-b] -w corpus [file | -]\n"
+                    "       %s -g spec -w corpus\n"
+                    "       %s [-j threads] [-p order] [-m cores [-f fit]] [-C] [-t] [-k entries] [-g spec] -G grid\n"
+                    "       %s [-t] -S socket\n"
+                    "       %s [-V] [-j threads] [-p order] [-s policy] [-m cores [-f fit]] [-x] [-C] [-t] [-o format] [-k entries] [-K file] -c corpus\n"
+                    "       %s [-j threads] [-p order] [-s policy] [-m cores [-f fit]] [-x] [-C] [-t] [-o format] [-k entries] [-K file] -g spec\n"
+                    "\t-b\tinput is binary records instead of T:C[:D] text lines\n"
+                    "\t-j\tworker threads, 0 uses every core (default 1)\n"
+                    "\t-w\tconvert the input into a memory mappable corpus instead of analyzing it\n"
+                    "\t-c\tanalyze a corpus in place\n"
+                    "\t-g\tanalyze (or with -w store) generated sets instead of reading any, spec is key=value pairs, e.g.\n"
+                    "\t\tsets=100000,n=4-64,u=0.8,method=rfs,tmin=10,tmax=1000,hyper=3600,d=0.5-1,seed=7,\n"
+                    "\t\tsee src/generator.h\n"
+                    "\t-G\tsweep the -g sets over a grid such as u=0.05-1:0.05,n=4-32:4 and print one row of\n"
+                    "\t\tacceptance ratios per (n, U) cell, every cell generates the spec's number of sets\n"
+                    "\t-S\tserve RM admission control on a Unix domain socket until SIGINT or SIGTERM, see\n"
+                    "\t\tsrc/server.h for the 16 byte request and reply records\n"
+                    "\t-V\tverify the corpus index and periods before analyzing it\n"
+                    "\t-p\tfixed priority order for the exact tests, given (file order, default), rm or dm\n"
+                    "\t-m\talso run the global EDF and fixed priority tests on that many cores and pack each\n"
+                    "\t\tset onto them under partitioned RM, printing the core of every service\n"
+                    "\t-f\tpacking heuristic ff, bf or wf (first, best, worst fit, default ff), a\n"
+                    "\t\ttrailing + tries the bounds on every core before any exact test, e.g. bf+\n"
+                    "\t-s\talso simulate each set under rm, dm, edf or llf and print the schedule\n"
+                    "\t-x\talso print the critical WCET scaling factor and the largest C and smallest T\n"
+                    "\t\tof every service that keep the set feasible under the -p order\n"
+                    "\t-o\tresult format, text (default), jsonl, csv or bin records carrying the response\n"
+                    "\t\ttimes, see src/sink.h. Records replace the text lines and their -s, -m, -x extras\n"
+                    "\t-k\tmemoize the single core verdicts of up to that many canonical sets, duplicated\n"
+                    "\t\tand (under -p rm or dm) permuted sets are answered from the memo\n"
+                    "\t-K\tload the memo from file if it exists and save it back after the run\n"
+                    "\t-C\tcascade, stop at the first of U > 1, LUB, hyperbolic, RTA and scheduling point\n"
+                    "\t\tthat settles a set and skip EDF demand where RTA already decides it\n"
+                    "\t-t\tprint the sets each stage settled, then per test counters and histograms\n"
+                    "\t\tto stderr at the end, the test counters need a make INSTRUMENT=1 build\n",
+            prog, prog, prog, prog, prog, prog, prog, prog);
+}
+
+static int parse_priority(const char *name) {
+    static const char *names[] = { "given", "rm", "dm" };
+    int k;
+
+    for(k = PRIO_GIVEN; k <= PRIO_DM; k++)
+        if(strcmp(name, names[k]) == 0)
+            return k;
+
+    return -1;
+}
+
+static int parse_fit(const char *name) {
+    static const char *names[] = { "ff", "bf", "wf" };
+    size_t len = strlen(name);
+    int k, bounds = 0;
+
+    if(len > 0 && name[len - 1] == '+')
+    {
+        bounds = PART_BOUNDS_FIRST;
+        len--;
+    }
+
+    for(k = PART_FIRST_FIT; k <= PART_WORST_FIT; k++)
+        if(strlen(names[k]) == len && strncmp(name, names[k], len) == 0)
+            return k | bounds;
+
+    return -1;
+}
+
+static int parse_policy(const char *name) {
+    static const char *names[] = { "rm", "dm", "edf", "llf" };
+    int k;
+
+    for(k = SIM_RM; k <= SIM_LLF; k++)
+        if(strcmp(name, names[k]) == 0)
+            return k;
+
+    return -1;
+}
+
+// pack one set of a chunk onto the -m cores and print its affinity map
+static void report_packing(const taskset_batch_t *batch, U32_T s) {
+    U32_T base = batch->offset[s], n = batch->offset[s + 1] - base;
+    U32_T *grown;
+    int placed;
+
+    if(n > partMapSize)
+    {
+        grown = realloc(partMap, sizeof(U32_T) * n);
+        if(grown == NULL)
+        {
+            fprintf(stdout, "\tpartition: out of memory\n");
+            return;
+        }
+        partMap     = grown;
+        partMapSize = n;
+    }
+
+    placed = partition_assign(&partition, n, batch->period + base, batch->wcet + base,
+                              batch->deadline + base, batchConfig.fit, partMap);
+    if(placed < 0)
+        fprintf(stdout, "\tpartition: out of memory\n");
+    else
+        report_partition(stdout, n, partMap, placed, batchConfig.numCores);
+}
+
+// sensitivity of one set of a chunk, searched in the -p order and printed in file order
+static void report_sensitivity_set(const taskset_batch_t *batch, U32_T s) {
+    U32_T base = batch->offset[s], n = batch->offset[s + 1] - base;
+    U32_T *grown, *order, *period, *wcet, *deadline, *maxWcet, *minPeriod, *scratch;
+    U32_T k;
+    double scale;
+
+    if(n > sensBufSize)
+    {
+        grown = realloc(sensBuf, sizeof(U32_T) * 10 * n);
+        if(grown == NULL)
+        {
+            fprintf(stdout, "\tsensitivity: out of memory\n");
+            return;
+        }
+        sensBuf     = grown;
+        sensBufSize = n;
+    }
+
+    order     = sensBuf;
+    period    = sensBuf + n;
+    wcet      = sensBuf + 2 * n;
+    deadline  = sensBuf + 3 * n;
+    maxWcet   = sensBuf + 4 * n;
+    minPeriod = sensBuf + 5 * n;
+    scratch   = sensBuf + 6 * n;
+
+    // the searches want the arrays in priority order, results go back to file order
+    priority_order(n, batch->period + base, batch->deadline + base, batchConfig.priority, order);
+    for(k = 0; k < n; k++)
+    {
+        period[k]   = batch->period[base + order[k]];
+        wcet[k]     = batch->wcet[base + order[k]];
+        deadline[k] = batch->deadline[base + order[k]];
+    }
+
+    for(k = 0; k < n; k++)
+    {
+        maxWcet[order[k]]   = sensitivity_max_wcet(n, period, wcet, deadline, k, scratch);
+        minPeriod[order[k]] = sensitivity_min_period(n, period, wcet, deadline, k, scratch);
+    }
+
+    scale = sensitivity_wcet_scale(n, period, wcet, deadline, scratch);
+    report_sensitivity(stdout, n, maxWcet, minPeriod, scale);
+}
+
+// file order is a valid RM (or DM) assignment, so -p given analyzed the levels -s simulates
+static int in_policy_order(U32_T n, const U32_T period[], const U32_T deadline[], int policy) {
+    const U32_T *key = (policy == SIM_DM) ? deadline : period;
+    U32_T k;
+
+    for(k = 1; k < n; k++)
+        if(key[k] < key[k - 1])
+            return FALSE;
+
+    return TRUE;
+}
+
+// report a chunk, with the simulated schedule and core packing of every set under each
+// result line when asked
+static void report_chunk(const taskset_batch_t *batch, const feasibility_result_t results[], U32_T firstId) {
+    static sim_record_t timeline[SIM_TIMELINE];
+    taskset_batch_t one;
+    sim_result_t sim;
+    U32_T s, base, n, k;
+    const U32_T *levels;
+    void *queues;
+    int verdict, analytic;
+
+    if(simPolicy < 0 && batchConfig.numCores == 0 && !sensitivity)
+    {
+        report_batch(stdout, batch, results, firstId);
+        return;
+    }
+
+    one = *batch;
+    one.numSets = 1;
+    sim.timeline = timeline;
+    sim.capacity = SIM_TIMELINE;
+
+    for(s = 0; s < batch->numSets; s++)
+    {
+        one.offset = batch->offset + s;
+        report_batch(stdout, &one, results + s, firstId + s);
+
+        if(batchConfig.numCores > 0)
+            report_packing(batch, s);
+
+        if(sensitivity)
+            report_sensitivity_set(batch, s);
+
+        if(simPolicy < 0)
+            continue;
+
+        base   = batch->offset[s];
+        n      = batch->offset[s + 1] - base;
+
+        // equal keys keep file order then, as they did in the analysis
+        levels = NULL;
+        if(batchConfig.priority == PRIO_GIVEN && (simPolicy == SIM_RM || simPolicy == SIM_DM) &&
+           in_policy_order(n, batch->period + base, batch->deadline + base, simPolicy) &&
+           workspace_reserve(&workspaces[0], n) == 0)
+        {
+            for(k = 0; k < n; k++)
+                workspaces[0].order[k] = k;
+            levels = workspaces[0].order;
+        }
+
+        queues = workspace_bytes(&workspaces[0], sim_scratch_bytes(n));
+        verdict = (queues != NULL)
+            ? sim_run_scratch(n, batch->period + base, batch->wcet + base, batch->deadline + base,
+                              levels, simPolicy, 0, queues, &sim)
+            : sim_run(n, batch->period + base, batch->wcet + base, batch->deadline + base,
+                      levels, simPolicy, 0, &sim);
+        // fixed priority runs are checked against the completion test, dynamic ones against EDF demand
+        analytic = (simPolicy == SIM_RM || simPolicy == SIM_DM) ? results[s].completion : results[s].edf;
+        report_schedule(stdout, simPolicy, verdict, &sim, analytic);
+    }
+}
+
+// point the batch at a response time column for every task of the chunk when records are on
+static int prepare_chunk(const taskset_batch_t *batch) {
+    U32_T tasks = batch->offset[batch->numSets] - batch->offset[0];
+    U32_T *grown;
+
+    if(sinkFormat < 0)
+        return 0;
+
+    if(tasks > respBufSize)
+    {
+        grown = realloc(respBuf, sizeof(U32_T) * tasks);
+        if(grown == NULL)
+            return -1;
+        respBuf     = grown;
+        respBufSize = tasks;
+    }
+
+    batchConfig.resp = respBuf;
+    return 0;
+}
+
+// records, or the report lines with their optional extras
+static int emit_chunk(const taskset_batch_t *batch, const feasibility_result_t results[], U32_T firstId) {
+    U32_T s;
+
+    for(s = 0; s < batch->numSets; s++)
+        stageCounts[results[s].stage]++;
+
+    if(sinkFormat < 0)
+    {
+        report_chunk(batch, results, firstId);
+        return 0;
+    }
+
+    if(sink_write(&sink, batch, results, respBuf, firstId) != 0)
+    {
+        fprintf(stderr, "result write failed\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+static int run_stream(FILE *in, int format, U32_T numThreads) {
+    taskset_arena_t arena;
+    taskset_batch_t batch;
+    loader_t loader;
+    feasibility_result_t *results;
+    U32_T setId = 0;
+    int n, rc = 0;
+
+    results = malloc(sizeof(feasibility_result_t) * STREAM_CHUNK);
+    if(results == NULL)
+        return -1;
+
+    taskset_arena_init(&arena);
+    loader_init(&loader, in, format);
+
+    // parse, analyze and report one chunk at a time so memory stays flat on any input size
+    while((n = loader_next(&loader, &arena, STREAM_CHUNK)) > 0)
+    {
+        taskset_arena_batch(&arena, &batch);
+        if(prepare_chunk(&batch) != 0 ||
+           feasibility_batch_parallel(&batch, &batchConfig, results, numThreads) != 0)
+        {
+            fprintf(stderr, "analysis failed, no memory or worker threads\n");
+            rc = -1;
+            break;
+        }
+        if(emit_chunk(&batch, results, setId) != 0)
+        {
+            rc = -1;
+            break;
+        }
+        setId += (U32_T)n;
+    }
+
+    if(n < 0)
+    {
+        fprintf(stderr, "input error, %s\n", loader.error);
+        rc = -1;
+    }
+
+    loader_free(&loader);
+    taskset_arena_free(&arena);
+    free(results);
+    return rc;
+}
+
+static int run_generate(const gen_config_t *cfg, U32_T numThreads, const char *path) {
+    taskset_arena_t arena;
+    taskset_batch_t batch;
+    generator_t gen;
+    feasibility_result_t *results;
+    FILE *out;
+    U64_T first;
+    U32_T n;
+    int rc = 0;
+
+    if(cfg->numSets > 0xFFFFFFFFull)
+    {
+        fprintf(stderr, "generator: at most %u sets per run\n", 0xFFFFFFFFu);
+        return -1;
+    }
+    if(gen_init(&gen, cfg) != 0)
+    {
+        fprintf(stderr, "generator: %s\n", gen.error);
+        return -1;
+    }
+
+    // a corpus needs every set in hand, the same as run_convert
+    if(path != NULL)
+    {
+        taskset_arena_init(&arena);
+        if(gen_fill(&gen, 0, (U32_T)cfg->numSets, &arena, workspaces, numThreads) != 0)
+        {
+            fprintf(stderr, "generator: %s\n", gen.error);
+            rc = -1;
+        }
+        else if((out = fopen(path, "wb")) == NULL)
+        {
+            perror(path);
+            rc = -1;
+        }
+        else
+        {
+            taskset_arena_batch(&arena, &batch);
+            if(corpus_write(out, &batch) != 0 || fclose(out) != 0)
+            {
+                fprintf(stderr, "%s: write failed\n", path);
+                rc = -1;
+            }
+        }
+        taskset_arena_free(&arena);
+        gen_free(&gen);
+        return rc;
+    }
+
+    results = malloc(sizeof(feasibility_result_t) * STREAM_CHUNK);
+    if(results == NULL)
+    {
+        gen_free(&gen);
+        return -1;
+    }
+
+    // the sets go straight into the arena the stream path analyzes, one chunk at a time
+    taskset_arena_init(&arena);
+    for(first = 0; first < cfg->numSets; first += n)
+    {
+        n = (cfg->numSets - first > STREAM_CHUNK) ? STREAM_CHUNK : (U32_T)(cfg->numSets - first);
+
+        if(gen_fill(&gen, first, n, &arena, workspaces, numThreads) != 0)
+        {
+            fprintf(stderr, "generator: %s\n", gen.error);
+            rc = -1;
+            break;
+        }
+
+        taskset_arena_batch(&arena, &batch);
+        if(prepare_chunk(&batch) != 0 ||
+           feasibility_batch_parallel(&batch, &batchConfig, results, numThreads) != 0)
+        {
+            fprintf(stderr, "analysis failed, no memory or worker threads\n");
+            rc = -1;
+            break;
+        }
+        if(emit_chunk(&batch, results, (U32_T)first) != 0)
+        {
+            rc = -1;
+            break;
+        }
+    }
+
+    taskset_arena_free(&arena);
+    gen_free(&gen);
+    free(results);
+    return rc;
+}
+
+static int run_sweep(const gen_config_t *base, const sweep_grid_t *grid, U32_T numThreads) {
+    U32_T cells = sweep_u_steps(grid) * sweep_n_steps(grid), k, n, s;
+    int multicore = (batchConfig.numCores > 0), rc = 0;
+    taskset_arena_t arena;
+    taskset_batch_t batch;
+    feasibility_result_t *results;
+    gen_config_t cfg = *base;
+    generator_t gen;
+    sweep_cell_t cell;
+    U64_T done;
+
+    results = malloc(sizeof(feasibility_result_t) * STREAM_CHUNK);
+    if(results == NULL)
+        return -1;
+
+    taskset_arena_init(&arena);
+    report_sweep_header(stdout, multicore);
+
+    // one chunk of sets and results is all a cell ever holds, the rest are counters
+    for(k = 0; k < cells && rc == 0; k++)
+    {
+        sweep_cell_init(&cell, grid, k);
+        cfg.minServices = cell.numServices;
+        cfg.maxServices = cell.numServices;
+        cfg.utilization = cell.utilization;
+        if(gen_init(&gen, &cfg) != 0)
+        {
+            fprintf(stderr, "generator: n=%u U=%.4f: %s\n", cell.numServices, cell.utilization, gen.error);
+            rc = -1;
+            break;
+        }
+
+        for(done = 0; done < cfg.numSets; done += n)
+        {
+            n = (cfg.numSets - done > STREAM_CHUNK) ? STREAM_CHUNK : (U32_T)(cfg.numSets - done);
+
+            if(gen_fill(&gen, (U64_T)k * cfg.numSets + done, n, &arena, workspaces, numThreads) != 0)
+            {
+                fprintf(stderr, "generator: %s\n", gen.error);
+                rc = -1;
+                break;
+            }
+
+            taskset_arena_batch(&arena, &batch);
+            if(feasibility_batch_parallel(&batch, &batchConfig, results, numThreads) != 0)
+            {
+                fprintf(stderr, "analysis failed, no memory or worker threads\n");
+                rc = -1;
+                break;
+            }
+
+            for(s = 0; s < n; s++)
+                stageCounts[results[s].stage]++;
+            sweep_accumulate(&cell, results, n);
+        }
+
+        gen_free(&gen);
+        if(rc == 0)
+        {
+            report_sweep_cell(stdout, &cell, multicore);
+            fflush(stdout);
+        }
+    }
+
+    taskset_arena_free(&arena);
+    free(results);
+    return rc;
+}
+
+static int run_convert(FILE *in, int format, const char *path) {
+    taskset_arena_t arena;
+    taskset_batch_t batch;
+    loader_t loader;
+    FILE *out;
+    int n, rc = 0;
+
+    taskset_arena_init(&arena);
+    loader_init(&loader, in, format);
+
+    // the columns are contiguous in the file, so the whole input has to be in hand first
+    if((n = loader_next(&loader, &arena, 0xFFFFFFFFu)) < 0)
+    {
+        fprintf(stderr, "input error, %s\n", loader.error);
+        rc = -1;
+    }
+    else if((out = fopen(path, "wb")) == NULL)
+    {
+        perror(path);
+        rc = -1;
+    }
+    else
+    {
+        taskset_arena_batch(&arena, &batch);
+        if(corpus_write(out, &batch) != 0 || fclose(out) != 0)
+        {
+            fprintf(stderr, "%s: write failed\n", path);
+            rc = -1;
+        }
+    }
+
+    loader_free(&loader);
+    taskset_arena_free(&arena);
+    return rc;
+}
+
+static int run_corpus(const char *path, int verify, U32_T numThreads) {
+    corpus_t corpus;
+    taskset_batch_t view;
+    feasibility_result_t *results;
+    U32_T first;
+    int rc = 0;
+
+    if(corpus_open(&corpus, path) != 0)
+    {
+        fprintf(stderr, "%s\n", corpus.error);
+        return -1;
+    }
+
+    if(verify && corpus_verify(&corpus) != 0)
+    {
+        fprintf(stderr, "%s: %s\n", path, corpus.error);
+        corpus_close(&corpus);
+        return -1;
+    }
+
+    results = malloc(sizeof(feasibility_result_t) * STREAM_CHUNK);
+    if(results == NULL)
+    {
+        corpus_close(&corpus);
+        return -1;
+    }
+
+    // windows over the mapping share its columns, only the offset index moves
+    view = corpus.batch;
+    for(first = 0; first < corpus.batch.numSets; first += view.numSets)
+    {
+        view.numSets = corpus.batch.numSets - first;
+        if(view.numSets > STREAM_CHUNK)
+            view.numSets = STREAM_CHUNK;
+        view.offset = corpus.batch.offset + first;
+
+        if(prepare_chunk(&view) != 0 ||
+           feasibility_batch_parallel(&view, &batchConfig, results, numThreads) != 0)
+        {
+            fprintf(stderr, "analysis failed, no memory or worker threads\n");
+            rc = -1;
+            break;
+        }
+        if(emit_chunk(&view, results, first) != 0)
+        {
+            rc = -1;
+            break;
+        }
+    }
+
+    free(results);
+    corpus_close(&corpus);
+    return rc;
+}
+
+int main(int argc, char *argv[]) {
+    int opt, format = LOADER_TEXT, verify = FALSE, stats = FALSE, rc;
+    const char *cachePath = NULL;
+    U64_T cacheEntries = 0;
+    feas_stats_t totals;
+    const char *corpusIn = NULL, *corpusOut = NULL;
+    gen_config_t genConfig;
+    const char *sweepSpec = NULL, *serverPath = NULL;
+    server_stats_t serverStats;
+    sweep_grid_t grid;
+    char genError[128];
+    int generate = FALSE;
+    U32_T numThreads = 1;
+    FILE *in = stdin;
+
+    if(argc == 1)
+    {
+        run_examples();
+        return 0;
+    }
+
+    while((opt = getopt(argc, argv, "bc:Cf:g:G:j:k:K:m:o:p:s:S:tw:xVh")) != -1)
+    {
+        switch(opt)
+        {
+            case 'b':
+                format = LOADER_BINARY;
+                break;
+            case 'c':
+                corpusIn = optarg;
+                break;
+            case 'C':
+                batchConfig.cascade = TRUE;
+                break;
+            case 'f':
+                if((batchConfig.fit = parse_fit(optarg)) < 0)
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'g':
+                if(!generate)
+                    gen_defaults(&genConfig);
+                if(gen_parse(&genConfig, optarg, genError) != 0)
+                {
+                    fprintf(stderr, "%s\n", genError);
+                    return 1;
+                }
+                generate = TRUE;
+                break;
+            case 'G':
+                sweepSpec = optarg;
+                break;
+            case 'k':
+                cacheEntries = strtoull(optarg, NULL, 10);
+                break;
+            case 'K':
+                cachePath = optarg;
+                break;
+            case 'm':
+                batchConfig.numCores = (U32_T)strtoul(optarg, NULL, 10);
+                break;
+            case 'j':
+                numThreads = (U32_T)strtoul(optarg, NULL, 10);
+                break;
+            case 'o':
+                if(strcmp(optarg, "text") == 0)
+                    sinkFormat = -1;
+                else if((sinkFormat = sink_format(optarg)) < 0)
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'p':
+                if((batchConfig.priority = parse_priority(optarg)) < 0)
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 's':
+                if((simPolicy = parse_policy(optarg)) < 0)
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'S':
+                serverPath = optarg;
+                break;
+            case 'w':
+                corpusOut = optarg;
+                break;
+            case 't':
+                stats = TRUE;
+                break;
+            case 'x':
+                sensitivity = TRUE;
+                break;
+            case 'V':
+                verify = TRUE;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(batchConfig.numCores > 0 && partition_init(&partition, batchConfig.numCores) != 0)
+    {
+        fprintf(stderr, "could not set up %u cores\n", batchConfig.numCores);
+        return 1;
+    }
+
+    // the daemon keeps its own admission context and shares nothing with the batch modes
+    if(serverPath != NULL)
+    {
+        if(server_run(serverPath, 0, &serverStats, genError) != 0)
+        {
+            fprintf(stderr, "%s\n", genError);
+            return 1;
+        }
+        if(stats)
+            fprintf(stderr, "server: %llu requests in %llu batches, %llu one at a time\n",
+                    serverStats.requests, serverStats.batches, serverStats.fallbacks);
+        return 0;
+    }
+
+    // the grid axes default to the single point the generator spec describes
+    if(sweepSpec != NULL)
+    {
+        if(!generate)
+            gen_defaults(&genConfig);
+        grid.uMin  = genConfig.utilization;
+        grid.uMax  = genConfig.utilization;
+        grid.uStep = 0.05;
+        grid.nMin  = genConfig.minServices;
+        grid.nMax  = genConfig.minServices;
+        grid.nStep = 1;
+        if(sweep_parse(&grid, sweepSpec, genError) != 0)
+        {
+            fprintf(stderr, "%s\n", genError);
+            return 1;
+        }
+    }
+
+    if(cachePath != NULL && cacheEntries == 0)
+        cacheEntries = CACHE_DEFAULT_ENTRIES;
+
+    if(cacheEntries > 0)
+    {
+        if(cache_init(&cache, cacheEntries) != 0 ||
+           (cachePath != NULL && cache_load(&cache, cachePath) < 0))
+        {
+            fprintf(stderr, "%s\n", cache.error);
+            cache_free(&cache);
+            if(batchConfig.numCores > 0)
+                partition_destroy(&partition);
+            return 1;
+        }
+        batchConfig.cache = &cache;
+    }
+
+    if(corpusOut != NULL)
+        sinkFormat = -1;
+
+    if(numThreads == 0)
+        numThreads = pool_default_threads();
+    if((workspaces = workspace_array(numThreads)) == NULL)
+    {
+        fprintf(stderr, "could not set up %u workspaces\n", numThreads);
+        rc = -1;
+        sinkFormat = -1;
+        goto done;
+    }
+    batchConfig.workspace     = workspaces;
+    batchConfig.numWorkspaces = numThreads;
+
+    if(sinkFormat >= 0 && sink_open(&sink, stdout, sinkFormat) != 0)
+    {
+        fprintf(stderr, "could not set up the result buffer\n");
+        rc = -1;
+        sinkFormat = -1;
+        goto done;
+    }
+
+    if(sweepSpec != NULL)
+    {
+        rc = run_sweep(&genConfig, &grid, numThreads);
+        goto done;
+    }
+
+    if(generate)
+    {
+        rc = run_generate(&genConfig, numThreads, corpusOut);
+        goto done;
+    }
+
+    if(corpusIn != NULL)
+    {
+        rc = run_corpus(corpusIn, verify, numThreads);
+        goto done;
+    }
+
+    if(optind < argc && strcmp(argv[optind], "-") != 0)
+    {
+        in = fopen(argv[optind], (format == LOADER_BINARY) ? "rb" : "r");
+        if(in == NULL)
+        {
+            perror(argv[optind]);
+            rc = -1;
+            goto done;
+        }
+    }
+
+    if(corpusOut != NULL)
+        rc = run_convert(in, format, corpusOut);
+    else
+        rc = run_stream(in, format, numThreads);
+
+    if(in != stdin)
+        fclose(in);
+
+done:
+    if(sinkFormat >= 0 && sink_close(&sink) != 0)
+    {
+        fprintf(stderr, "result write failed\n");
+        rc = -1;
+    }
+
+    if(batchConfig.cache != NULL)
+    {
+        if(stats)
+            fprintf(stderr, "cache: %llu hits, %llu misses\n", cache.hits, cache.misses);
+        if(cachePath != NULL && rc == 0 && cache_save(&cache, cachePath) != 0)
+        {
+            fprintf(stderr, "%s\n", cache.error);
+            rc = -1;
+        }
+        cache_free(&cache);
+    }
+
+    if(stats)
+    {
+        report_stages(stderr, stageCounts);
+        if(!feas_instrumented())
+            fprintf(stderr, "built without FEAS_INSTRUMENT, rebuild with make INSTRUMENT=1\n");
+        feas_stats_snapshot(&totals);
+        report_stats(stderr, &totals);
+    }
+
+    if(batchConfig.numCores > 0)
+        partition_destroy(&partition);
+    workspace_array_free(workspaces, batchConfig.numWorkspaces);
+    free(partMap);
+    free(sensBuf);
+    free(respBuf);
+
+    return (rc == 0) ? 0 : 1;
+}
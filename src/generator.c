@@ -0,0 +1,605 @@
+/**
+ *  @name   generator
+ *  @brief  seeded random task sets written straight into a batch arena
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "generator.h"
+#include "pool.h"
+
+// sets per pool chunk, a few microseconds of work each
+#define GEN_GRAIN   64
+
+typedef struct {
+    generator_t         *gen;
+    taskset_arena_t     *arena;
+    feas_workspace_t    *ws;
+    U64_T               firstSet;
+    volatile int        failed;     // 1 out of memory, 2 discard gave up
+} gen_job_t;
+
+static inline U64_T rotl(U64_T x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline U64_T splitmix64(U64_T *x) {
+    U64_T z = (*x += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void gen_rng_seed(gen_rng_t *rng, U64_T seed, U64_T set) {
+    U64_T x = seed, k;
+
+    // the set index goes through its own mix first, so neighbouring sets share no state bits
+    k = set;
+    x ^= splitmix64(&k);
+    rng->s[0] = splitmix64(&x);
+    rng->s[1] = splitmix64(&x);
+    rng->s[2] = splitmix64(&x);
+    rng->s[3] = splitmix64(&x);
+}
+
+// xoshiro256**, Blackman and Vigna
+U64_T gen_rng_next(gen_rng_t *rng) {
+    U64_T *s = rng->s;
+    U64_T result = rotl(s[1] * 5, 7) * 9, t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = rotl(s[3], 45);
+
+    return result;
+}
+
+double gen_rng_uniform(gen_rng_t *rng) {
+    return (double)(gen_rng_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void gen_defaults(gen_config_t *cfg) {
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->numSets     = 1000;
+    cfg->minServices = 8;
+    cfg->maxServices = 8;
+    cfg->method      = GEN_UUNIFAST;
+    cfg->utilization = 0.7;
+    cfg->periodMin   = 10.0;
+    cfg->periodMax   = 10000.0;
+    cfg->deadlineMin = 1.0;
+    cfg->deadlineMax = 1.0;
+    cfg->sorted      = TRUE;
+    cfg->seed        = 1;
+}
+
+// "a" or "a-b" as doubles, FALSE on trailing junk
+static int parse_range(const char *text, double *lo, double *hi) {
+    char *end;
+
+    *lo = strtod(text, &end);
+    *hi = *lo;
+    if(*end == '-')
+        *hi = strtod(end + 1, &end);
+
+    return (end != text && *end == '\0') ? TRUE : FALSE;
+}
+
+static int parse_pair(gen_config_t *cfg, const char *key, const char *value) {
+    static const char *methods[] = { "uunifast", "discard", "rfs" };
+    double lo, hi;
+    char *end;
+    int k;
+
+    if(strcmp(key, "method") == 0)
+    {
+        for(k = GEN_UUNIFAST; k <= GEN_RANDFIXEDSUM; k++)
+            if(strcmp(value, methods[k]) == 0)
+            {
+                cfg->method = k;
+                return TRUE;
+            }
+        return FALSE;
+    }
+
+    if(!parse_range(value, &lo, &hi))
+        return FALSE;
+
+    if(strcmp(key, "n") == 0 && lo >= 0.0 && hi >= 0.0 && hi <= (double)GEN_MAX_SERVICES)
+    {
+        cfg->minServices = (U32_T)lo;
+        cfg->maxServices = (U32_T)hi;
+    }
+    else if(strcmp(key, "d") == 0)
+    {
+        cfg->deadlineMin = lo;
+        cfg->deadlineMax = hi;
+    }
+    else if(lo != hi)
+        return FALSE;
+    else if(strcmp(key, "u") == 0)
+        cfg->utilization = lo;
+    else if(strcmp(key, "tmin") == 0)
+        cfg->periodMin = lo;
+    else if(strcmp(key, "tmax") == 0)
+        cfg->periodMax = lo;
+    // the integer keys are read again as integers, a double loses precision past 2^53
+    else if(strcmp(key, "sets") == 0)
+        cfg->numSets = strtoull(value, &end, 10);
+    else if(strcmp(key, "gran") == 0)
+        cfg->granularity = (U32_T)strtoul(value, &end, 10);
+    else if(strcmp(key, "hyper") == 0)
+        cfg->hyperperiod = strtoull(value, &end, 10);
+    else if(strcmp(key, "seed") == 0)
+        cfg->seed = strtoull(value, &end, 10);
+    else if(strcmp(key, "sort") == 0)
+        cfg->sorted = (lo != 0.0) ? TRUE : FALSE;
+    else
+        return FALSE;
+
+    return TRUE;
+}
+
+int gen_parse(gen_config_t *cfg, const char *spec, char error[128]) {
+    char buf[256], *pair, *value, *next;
+
+    if(strlen(spec) >= sizeof(buf))
+    {
+        snprintf(error, 128, "generator spec longer than %zu characters", sizeof(buf) - 1);
+        return -1;
+    }
+    strcpy(buf, spec);
+
+    for(pair = buf; pair != NULL && *pair != '\0'; pair = next)
+    {
+        if((next = strchr(pair, ',')) != NULL)
+            *next++ = '\0';
+
+        if((value = strchr(pair, '=')) == NULL || (*value++ = '\0', !parse_pair(cfg, pair, value)))
+        {
+            snprintf(error, 128, "bad generator setting '%.96s'", pair);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// Stafford's randfixedsum table for n values in [0, 1] summing to s, row i (i = 1 .. n - 1)
+// holds the probabilities of stepping down a simplex slice with i + 1 values still to draw
+static int rfs_table(generator_t *gen, U32_T n, double s) {
+    U32_T k = (s >= (double)(n - 1)) ? n - 1 : (U32_T)floor(s);
+    double *w, *wNext, *s1, *s2, tmp1, tmp2, tmp3;
+    double tiny = DBL_MIN * DBL_EPSILON;
+    size_t size = (size_t)n * (n + 1) / 2;
+    U32_T i, c;
+
+    gen->table = malloc(sizeof(double) * size);
+    w = calloc(4 * ((size_t)n + 1), sizeof(double));
+    if(gen->table == NULL || w == NULL)
+    {
+        free(w);
+        return -1;
+    }
+    wNext = w + n + 1;
+    s1    = wNext + n + 1;
+    s2    = s1 + n + 1;
+
+    if(s < (double)k)
+        s = (double)k;
+    if(s > (double)k + 1.0)
+        s = (double)k + 1.0;
+
+    for(c = 0; c < n; c++)
+    {
+        s1[c] = s - ((double)k - (double)c);
+        s2[c] = ((double)k + (double)n - (double)c) - s;
+    }
+
+    // w starts at DBL_MAX and is scaled down a row at a time, which keeps it off the
+    // denormals for every n this table is built for
+    w[1] = DBL_MAX;
+    for(i = 2; i <= n; i++)
+    {
+        memset(wNext, 0, sizeof(double) * (n + 1));
+        for(c = 1; c <= i; c++)
+        {
+            tmp1 = w[c] * s1[c - 1] / (double)i;
+            tmp2 = w[c - 1] * s2[n - i + c - 1] / (double)i;
+            wNext[c] = tmp1 + tmp2;
+            tmp3 = wNext[c] + tiny;
+            gen->table[(size_t)(i - 1) * i / 2 - 1 + (c - 1)] =
+                (s2[n - i + c - 1] > s1[c - 1]) ? tmp2 / tmp3 : 1.0 - tmp1 / tmp3;
+        }
+        memcpy(w, wNext, sizeof(double) * (n + 1));
+    }
+
+    free(w);
+    return 0;
+}
+
+// every divisor of hyper inside [lo, hi], ascending
+static int hyper_divisors(generator_t *gen, U64_T hyper, double lo, double hi) {
+    U32_T count = 0, cap = 64, k;
+    U64_T d, q;
+    U32_T *grown;
+
+    gen->divisors = malloc(sizeof(U32_T) * cap);
+    if(gen->divisors == NULL)
+        return -1;
+
+    for(d = 1; d * d <= hyper; d++)
+    {
+        if(hyper % d != 0)
+            continue;
+
+        for(k = 0, q = d; k < 2; k++, q = hyper / d)
+        {
+            if(k == 1 && q == d)
+                break;
+            if((double)q < lo || (double)q > hi || q > 0xFFFFFFFFull)
+                continue;
+            if(count == cap)
+            {
+                if((grown = realloc(gen->divisors, sizeof(U32_T) * cap * 2)) == NULL)
+                    return -1;
+                gen->divisors = grown;
+                cap *= 2;
+            }
+            gen->divisors[count++] = (U32_T)q;
+        }
+    }
+
+    // the pairs come out as small, large, small, large, one insertion pass orders them
+    for(k = 1; k < count; k++)
+    {
+        U32_T v = gen->divisors[k], j;
+        for(j = k; j > 0 && gen->divisors[j - 1] > v; j--)
+            gen->divisors[j] = gen->divisors[j - 1];
+        gen->divisors[j] = v;
+    }
+
+    gen->numDivisors = count;
+    gen->logDivisors = malloc(sizeof(double) * (count > 0 ? count : 1));
+    if(gen->logDivisors == NULL)
+        return -1;
+    for(k = 0; k < count; k++)
+        gen->logDivisors[k] = log((double)gen->divisors[k]);
+
+    return 0;
+}
+
+int gen_init(generator_t *gen, const gen_config_t *cfg) {
+    const char *why = NULL;
+
+    memset(gen, 0, sizeof(*gen));
+    gen->cfg = *cfg;
+
+    if(cfg->minServices == 0 || cfg->maxServices < cfg->minServices ||
+       cfg->maxServices > GEN_MAX_SERVICES)
+        why = "n must be in 1..65536 with min <= max";
+    else if(!(cfg->utilization > 0.0))
+        why = "u must be positive";
+    else if(cfg->method == GEN_UUNIFAST_DISCARD && cfg->utilization > (double)cfg->minServices)
+        why = "discard needs u <= n";
+    else if(cfg->method == GEN_RANDFIXEDSUM &&
+            (cfg->minServices != cfg->maxServices || cfg->maxServices > GEN_RFS_MAX_SERVICES ||
+             cfg->utilization > (double)cfg->minServices))
+        why = "rfs needs one n up to 4096 and u <= n";
+    else if(!(cfg->periodMin >= 1.0) || !(cfg->periodMax >= cfg->periodMin) ||
+            cfg->periodMax > 4294967295.0)
+        why = "periods must satisfy 1 <= tmin <= tmax < 2^32";
+    else if(!(cfg->deadlineMin > 0.0) || !(cfg->deadlineMax >= cfg->deadlineMin))
+        why = "deadline ratios must satisfy 0 < min <= max";
+    else if(cfg->hyperperiod > GEN_MAX_HYPERPERIOD)
+        why = "hyper must be at most 2^48";
+
+    if(why != NULL)
+    {
+        snprintf(gen->error, sizeof(gen->error), "%s", why);
+        return -1;
+    }
+
+    if(cfg->method == GEN_RANDFIXEDSUM && cfg->minServices > 1 &&
+       rfs_table(gen, cfg->minServices, cfg->utilization) != 0)
+    {
+        snprintf(gen->error, sizeof(gen->error), "no memory for the RandFixedSum table");
+        gen_free(gen);
+        return -1;
+    }
+
+    if(cfg->hyperperiod > 0)
+    {
+        if(hyper_divisors(gen, cfg->hyperperiod, cfg->periodMin, cfg->periodMax) != 0)
+        {
+            snprintf(gen->error, sizeof(gen->error), "no memory for the hyperperiod divisors");
+            gen_free(gen);
+            return -1;
+        }
+        if(gen->numDivisors == 0)
+        {
+            snprintf(gen->error, sizeof(gen->error), "hyper %llu has no divisor in [%.0f, %.0f]",
+                     cfg->hyperperiod, cfg->periodMin, cfg->periodMax);
+            gen_free(gen);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void gen_free(generator_t *gen) {
+    free(gen->table);
+    free(gen->divisors);
+    free(gen->logDivisors);
+    gen->table       = NULL;
+    gen->divisors    = NULL;
+    gen->logDivisors = NULL;
+    gen->numDivisors = 0;
+}
+
+// Bini and Buttazzo, n utilizations uniform over the simplex summing to total
+static void uunifast(gen_rng_t *rng, U32_T n, double total, double u[]) {
+    double sum = total, next;
+    U32_T i;
+
+    for(i = 0; i + 1 < n; i++)
+    {
+        next = sum * pow(gen_rng_uniform(rng), 1.0 / (double)(n - i - 1));
+        u[i] = sum - next;
+        sum  = next;
+    }
+    u[n - 1] = sum;
+}
+
+// Stafford's sampler walking the table down from the slice that holds total
+static void randfixedsum(const generator_t *gen, gen_rng_t *rng, U32_T n, double total, double u[]) {
+    U32_T k = (total >= (double)(n - 1)) ? n - 1 : (U32_T)floor(total);
+    U32_T i, j, e, swap;
+    double s = total, sm = 0.0, pr = 1.0, sx, tmp;
+
+    if(n == 1)
+    {
+        u[0] = total;
+        return;
+    }
+
+    if(s < (double)k)
+        s = (double)k;
+    if(s > (double)k + 1.0)
+        s = (double)k + 1.0;
+
+    for(i = n - 1, j = k + 1; i >= 1; i--)
+    {
+        e  = (gen_rng_uniform(rng) <= gen->table[(size_t)i * (i + 1) / 2 - 1 + (j - 1)]) ? 1 : 0;
+        sx = pow(gen_rng_uniform(rng), 1.0 / (double)i);
+        sm += (1.0 - sx) * pr * s / (double)(i + 1);
+        pr *= sx;
+        u[n - 1 - i] = sm + pr * (double)e;
+        s -= (double)e;
+        j -= e;
+    }
+    u[n - 1] = sm + pr * s;
+
+    // the walk fills the values in a fixed order, a shuffle makes them exchangeable
+    for(i = n - 1; i > 0; i--)
+    {
+        swap    = (U32_T)(gen_rng_next(rng) % (i + 1));
+        tmp     = u[i];
+        u[i]    = u[swap];
+        u[swap] = tmp;
+    }
+}
+
+static U32_T draw_period(const generator_t *gen, gen_rng_t *rng, double logMin, double logSpan) {
+    double x = logMin + gen_rng_uniform(rng) * logSpan, t;
+    U32_T lo = 0, hi, mid, g = gen->cfg.granularity;
+
+    if(gen->numDivisors > 0)
+    {
+        // nearest divisor in log space, so the spread stays close to log-uniform
+        hi = gen->numDivisors - 1;
+        while(lo < hi)
+        {
+            mid = lo + (hi - lo) / 2;
+            if(gen->logDivisors[mid] < x)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if(lo > 0 && x - gen->logDivisors[lo - 1] < gen->logDivisors[lo] - x)
+            lo--;
+        return gen->divisors[lo];
+    }
+
+    t = floor(exp(x) + 0.5);
+    if(g > 1)
+        t = floor(t / (double)g + 0.5) * (double)g;
+    if(t < 1.0)
+        t = (g > 1) ? (double)g : 1.0;
+    return (t > 4294967295.0) ? 0xFFFFFFFFu : (U32_T)t;
+}
+
+static void sort_periods(U32_T t[], U32_T n) {
+    U32_T i, j, root, child, v;
+
+    if(n <= 32)
+    {
+        for(i = 1; i < n; i++)
+        {
+            v = t[i];
+            for(j = i; j > 0 && t[j - 1] > v; j--)
+                t[j] = t[j - 1];
+            t[j] = v;
+        }
+        return;
+    }
+
+    // heap sort for the large sets, in place and n log n whatever the draw
+    for(i = n / 2; i-- > 0;)
+        for(root = i; (child = 2 * root + 1) < n; root = child)
+        {
+            if(child + 1 < n && t[child + 1] > t[child])
+                child++;
+            if(t[root] >= t[child])
+                break;
+            v = t[root]; t[root] = t[child]; t[child] = v;
+        }
+    for(i = n - 1; i > 0; i--)
+    {
+        v = t[0]; t[0] = t[i]; t[i] = v;
+        for(root = 0; (child = 2 * root + 1) < i; root = child)
+        {
+            if(child + 1 < i && t[child + 1] > t[child])
+                child++;
+            if(t[root] >= t[child])
+                break;
+            v = t[root]; t[root] = t[child]; t[child] = v;
+        }
+    }
+}
+
+static inline U32_T draw_count(const gen_config_t *cfg, gen_rng_t *rng) {
+    if(cfg->minServices == cfg->maxServices)
+        return cfg->minServices;
+
+    return cfg->minServices + (U32_T)(gen_rng_next(rng) % (cfg->maxServices - cfg->minServices + 1));
+}
+
+// one set into its slot of the arena, 0 or the gen_job_t failure code
+static int gen_set(const generator_t *gen, U64_T set, double u[], U32_T n, U32_T period[],
+                   U32_T wcet[], U32_T deadline[]) {
+    const gen_config_t *cfg = &gen->cfg;
+    double logMin = log(cfg->periodMin), logSpan = log(cfg->periodMax) - logMin;
+    double c, d, r;
+    U32_T i, tries = 0;
+    gen_rng_t rng;
+
+    gen_rng_seed(&rng, cfg->seed, set);
+    (void)draw_count(cfg, &rng);
+
+    if(cfg->method == GEN_RANDFIXEDSUM)
+        randfixedsum(gen, &rng, n, cfg->utilization, u);
+    else
+    {
+        while(1)
+        {
+            uunifast(&rng, n, cfg->utilization, u);
+            if(cfg->method != GEN_UUNIFAST_DISCARD)
+                break;
+            for(i = 0; i < n && u[i] <= 1.0; i++)
+                ;
+            if(i == n)
+                break;
+            if(++tries == GEN_DISCARD_TRIES)
+                return 2;
+        }
+    }
+
+    for(i = 0; i < n; i++)
+        period[i] = draw_period(gen, &rng, logMin, logSpan);
+    if(cfg->sorted)
+        sort_periods(period, n);
+
+    for(i = 0; i < n; i++)
+    {
+        c = floor(u[i] * (double)period[i] + 0.5);
+        wcet[i] = (c < 1.0) ? 1 : (c > 4294967295.0) ? 0xFFFFFFFFu : (U32_T)c;
+
+        r = (cfg->deadlineMin == cfg->deadlineMax) ? cfg->deadlineMin
+            : cfg->deadlineMin + gen_rng_uniform(&rng) * (cfg->deadlineMax - cfg->deadlineMin);
+        d = floor((double)period[i] * r + 0.5);
+        deadline[i] = (d < (double)wcet[i]) ? wcet[i] : (d > 4294967295.0) ? 0xFFFFFFFFu : (U32_T)d;
+    }
+
+    return 0;
+}
+
+static void gen_chunk(void *ctx, U32_T first, U32_T last, U32_T worker) {
+    gen_job_t *job = (gen_job_t *)ctx;
+    taskset_arena_t *arena = job->arena;
+    U32_T s, n, base;
+    double *u;
+    int rc;
+
+    for(s = first; s < last && !job->failed; s++)
+    {
+        base = arena->offset[s];
+        n    = arena->offset[s + 1] - base;
+
+        if((u = workspace_bytes(&job->ws[worker], sizeof(double) * n)) == NULL)
+            rc = 1;
+        else
+            rc = gen_set(job->gen, job->firstSet + s, u, n, arena->period + base, arena->wcet + base,
+                         arena->deadline + base);
+
+        if(rc != 0)
+            __atomic_store_n(&job->failed, rc, __ATOMIC_RELAXED);
+    }
+}
+
+int gen_fill(generator_t *gen, U64_T firstSet, U32_T numSets, taskset_arena_t *arena,
+             feas_workspace_t ws[], U32_T numThreads) {
+    gen_job_t job = { gen, arena, ws, firstSet, 0 };
+    U32_T s, owned = 0;
+    U64_T tasks = 0;
+    gen_rng_t rng;
+
+    // the set sizes come first and serially, every set's slot is known before any is filled
+    taskset_arena_reset(arena);
+    if(taskset_arena_reserve(arena, numSets, 0) != 0)
+    {
+        snprintf(gen->error, sizeof(gen->error), "no memory for %u sets", numSets);
+        return -1;
+    }
+    for(s = 0; s < numSets; s++)
+    {
+        gen_rng_seed(&rng, gen->cfg.seed, firstSet + s);
+        arena->offset[s] = (U32_T)tasks;
+        tasks += draw_count(&gen->cfg, &rng);
+    }
+    if(tasks > 0xFFFFFFFFull || taskset_arena_reserve(arena, numSets, (U32_T)tasks) != 0)
+    {
+        snprintf(gen->error, sizeof(gen->error), "no memory for %llu tasks", tasks);
+        return -1;
+    }
+    arena->offset[numSets] = (U32_T)tasks;
+    arena->numSets         = numSets;
+    arena->numTasks        = (U32_T)tasks;
+
+    if(numThreads == 0)
+        numThreads = pool_default_threads();
+    if(job.ws == NULL)
+    {
+        if((job.ws = workspace_array(numThreads)) == NULL)
+        {
+            snprintf(gen->error, sizeof(gen->error), "no memory for %u workspaces", numThreads);
+            return -1;
+        }
+        owned = numThreads;
+    }
+
+    if(pool_parallel_for(numSets, GEN_GRAIN, numThreads, gen_chunk, &job) != 0)
+        job.failed = 1;
+
+    workspace_array_free((owned > 0) ? job.ws : NULL, owned);
+
+    if(job.failed == 2)
+        snprintf(gen->error, sizeof(gen->error), "discard found no set with every U(i) <= 1 in %u tries",
+                 GEN_DISCARD_TRIES);
+    else if(job.failed)
+        snprintf(gen->error, sizeof(gen->error), "no memory for the generator scratch");
+
+    return job.failed ? -1 : 0;
+}
@@ -0,0 +1,139 @@
+/**
+ *  @name   generator
+ *  @brief  seeded random task sets written straight into a batch arena
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Bini, Enrico, and Giorgio C. Buttazzo. "Measuring the performance of schedulability tests."
+ *          Real-Time Systems 30.1 (2005): 129-154.
+ *  @cite   Davis, Robert I., and Alan Burns. "Improved priority assignment for global fixed priority
+ *          pre-emptive scheduling in multiprocessor real-time systems." Real-Time Systems 47.1 (2011): 1-40.
+ *  @cite   Emberson, Paul, Roger Stafford, and Robert I. Davis. "Techniques for the synthesis of
+ *          multiprocessor tasksets." WATERS 2010: 6-11.
+ *  @cite   Goossens, Joel, and Christophe Macq. "Limitation of the hyper-period in real-time periodic
+ *          task set generation." RTS 2001: 133-148.
+ *
+ *  Per set, in order:
+ *      n           uniform in [minServices, maxServices]
+ *      U(i)        summing to utilization:
+ *                      GEN_UUNIFAST            uniform over the simplex
+ *                      GEN_UUNIFAST_DISCARD    the same, redrawn until every U(i) <= 1
+ *                      GEN_RANDFIXEDSUM        uniform over the simplex cut to [0, 1]^n
+ *      T(i)        log-uniform in [periodMin, periodMax], then rounded to a multiple of
+ *                  granularity, or snapped to the nearest divisor of hyperperiod, which
+ *                  bounds the hyperperiod of every set by it
+ *      C(i)        max(1, round(U(i) * T(i)))
+ *      D(i)        max(C(i), round(T(i) * r)), r uniform in [deadlineMin, deadlineMax]
+ *
+ *  Services are emitted in increasing period order when sorted is set. The draws are
+ *  exchangeable, so pairing the sorted periods with utilizations in draw order does not
+ *  bias the sets.
+ *
+ *  Every set draws from its own xoshiro256** stream, seeded from (seed, set index). A set
+ *  is therefore the same whichever worker generates it and however the run is chunked.
+*/
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include "loader.h"
+#include "workspace.h"
+
+#define GEN_UUNIFAST            0
+#define GEN_UUNIFAST_DISCARD    1
+#define GEN_RANDFIXEDSUM        2
+
+// largest set
+#define GEN_MAX_SERVICES        65536
+
+// largest RandFixedSum set, its table holds about n^2 / 2 doubles
+#define GEN_RFS_MAX_SERVICES    4096
+
+// UUniFast-Discard redraws per set before the generation fails
+#define GEN_DISCARD_TRIES       100000
+
+// largest hyperperiod limit, its divisors are found by trial division up to its root
+#define GEN_MAX_HYPERPERIOD     (1ull << 48)
+
+typedef struct {
+    U64_T   numSets;        // sets a run generates, the library only reads it through gen_parse
+    U32_T   minServices;
+    U32_T   maxServices;
+    int     method;         // GEN_*
+    double  utilization;    // total of every set
+    double  periodMin;
+    double  periodMax;
+    U32_T   granularity;    // 0 or 1 for none
+    U64_T   hyperperiod;    // 0 for none, takes precedence over granularity
+    double  deadlineMin;    // D / T range, 1 and 1 for implicit deadlines
+    double  deadlineMax;
+    int     sorted;         // emit each set in rate monotonic order
+    U64_T   seed;
+} gen_config_t;
+
+/**
+ *  A validated config with its precomputed tables, read only while generating.
+*/
+typedef struct {
+    gen_config_t    cfg;
+    double          *table;         // RandFixedSum transition probabilities, row i has i + 1
+    U32_T           *divisors;      // divisors of hyperperiod in [periodMin, periodMax]
+    double          *logDivisors;
+    U32_T           numDivisors;
+    char            error[128];
+} generator_t;
+
+typedef struct {
+    U64_T   s[4];
+} gen_rng_t;
+
+/**
+ *  @brief  defaults: 1000 sets of 8 services, U = 0.7, UUniFast, periods 10..10000 with
+ *          implicit deadlines, sorted, seed 1
+*/
+void gen_defaults(gen_config_t *cfg);
+
+/**
+ *  @brief  apply comma separated key=value pairs on top of cfg
+ *
+ *  Keys: sets, n (count or min-max), u, method (uunifast, discard, rfs), tmin, tmax, gran,
+ *  hyper, d (ratio or min-max), sort (0 or 1), seed. Example: sets=100000,n=4-64,u=0.8,hyper=3600
+ *
+ *  @return 0, or -1 with error describing the first bad pair
+*/
+int gen_parse(gen_config_t *cfg, const char *spec, char error[128]);
+
+/**
+ *  @brief  validate cfg and build the RandFixedSum and hyperperiod tables
+ *
+ *  @return 0, or -1 with gen->error set
+*/
+int gen_init(generator_t *gen, const gen_config_t *cfg);
+void gen_free(generator_t *gen);
+
+/**
+ *  @brief  stream of one set, independent of every other (seed, set) pair
+*/
+void gen_rng_seed(gen_rng_t *rng, U64_T seed, U64_T set);
+U64_T gen_rng_next(gen_rng_t *rng);
+
+/**
+ *  @brief  uniform in [0, 1) with 53 random bits
+*/
+double gen_rng_uniform(gen_rng_t *rng);
+
+/**
+ *  @brief  reset the arena to sets [firstSet, firstSet + numSets), generated over numThreads
+ *          workers, 0 uses every core
+ *
+ *  @param  ws  numThreads workspaces for the per worker scratch, or NULL to set some up for
+ *              this call
+ *
+ *  @return 0, or -1 with gen->error set if the arena could not grow or UUniFast-Discard
+ *          gave up on a set
+*/
+int gen_fill(generator_t *gen, U64_T firstSet, U32_T numSets, taskset_arena_t *arena,
+             feas_workspace_t ws[], U32_T numThreads);
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ *  @name   global
+ *  @brief  sufficient schedulability tests for global multiprocessor EDF and fixed priority
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+
+// the GFB bound has no exact predicate behind it, so a density within this of the bound is
+// rejected, far more than the rounding of the double sum, and the test never passes on it
+#define GLOBAL_EPSILON  1e-9
+
+void global_table_init(global_table_t *table) {
+    memset(table, 0, sizeof(*table));
+}
+
+void global_table_free(global_table_t *table) {
+    free(table->deadline);
+    free(table->resp);
+    free(table->bcl);
+    memset(table, 0, sizeof(*table));
+}
+
+static int global_reserve(global_table_t *table, U32_T count) {
+    U32_T *deadline, *resp;
+    U64_T *bcl;
+
+    if(count <= table->capacity)
+        return 0;
+
+    deadline = realloc(table->deadline, sizeof(U32_T) * count);
+    if(deadline != NULL)
+        table->deadline = deadline;
+    resp = realloc(table->resp, sizeof(U32_T) * count);
+    if(resp != NULL)
+        table->resp = resp;
+    bcl = realloc(table->bcl, sizeof(U64_T) * count);
+    if(bcl != NULL)
+        table->bcl = bcl;
+
+    if(deadline == NULL || resp == NULL || bcl == NULL)
+        return -1;
+
+    table->capacity = count;
+    return 0;
+}
+
+// BCL bound on the work of service i inside the window [r(k), d(k)) of a job of service k,
+// N = floor((D(k) - D(i))/T(i)) + 1 jobs have their deadline inside, plus one carried in
+static U64_T bcl_interference(U32_T ti, U32_T ci, U32_T di, U32_T dk) {
+    U64_T jobs, rest;
+
+    jobs = (dk >= di) ? (U64_T)((dk - di) / ti) + 1 : 0;
+    rest = (jobs * ti < dk) ? dk - jobs * ti : 0;
+
+    return jobs * ci + ((rest < ci) ? rest : ci);
+}
+
+int global_table_build(global_table_t *table, U32_T numServices, const U32_T period[],
+                       const U32_T wcet[], const U32_T deadline[], U32_T numCores) {
+    U32_T i, k;
+    U64_T cap, sum, w;
+    double lambda;
+
+    if(numCores == 0 || global_reserve(table, numServices) != 0)
+        return -1;
+
+    table->numServices = numServices;
+    table->numCores    = numCores;
+    table->period      = period;
+    table->wcet        = wcet;
+    table->density     = 0.0;
+    table->maxDensity  = 0.0;
+    table->overrun     = FALSE;
+
+    for(i = 0; i < numServices; i++)
+    {
+        table->deadline[i] = (deadline[i] < period[i]) ? deadline[i] : period[i];
+        if(wcet[i] > table->deadline[i])
+        {
+            table->overrun = TRUE;
+            return 0;
+        }
+
+        lambda = (double)wcet[i] / (double)table->deadline[i];
+        table->density += lambda;
+        if(lambda > table->maxDensity)
+            table->maxDensity = lambda;
+    }
+
+    // the one O(n^2) pass, every later BCL query is a single comparison per service
+    for(k = 0; k < numServices; k++)
+    {
+        cap = (U64_T)(table->deadline[k] - wcet[k]) + 1;
+        sum = 0;
+
+        for(i = 0; i < numServices; i++)
+        {
+            if(i == k)
+                continue;
+            w    = bcl_interference(period[i], wcet[i], table->deadline[i], table->deadline[k]);
+            sum += (w < cap) ? w : cap;
+        }
+
+        table->bcl[k] = sum;
+    }
+
+    return 0;
+}
+
+int global_edf_gfb(const global_table_t *table) {
+    double m = (double)table->numCores;
+
+    if(table->overrun)
+        return FALSE;
+
+    return (table->density <= m - (m - 1.0) * table->maxDensity - GLOBAL_EPSILON) ? TRUE : FALSE;
+}
+
+int global_edf_bcl(const global_table_t *table) {
+    U32_T k;
+    U64_T cap;
+
+    if(table->overrun)
+        return FALSE;
+
+    for(k = 0; k < table->numServices; k++)
+    {
+        cap = (U64_T)(table->deadline[k] - table->wcet[k]) + 1;
+        if(table->bcl[k] >= (U64_T)table->numCores * cap)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+// W(i, L) = N*C(i) + min(C(i), L + R(i) - C(i) - N*T(i)) with N = floor((L + R(i) - C(i))/T(i))
+static inline U64_T fp_workload(U32_T ti, U32_T ci, U32_T ri, U64_T window) {
+    U64_T span = window + ri - ci;
+    U64_T jobs = span / ti;
+    U64_T rest = span - jobs * ti;
+
+    return jobs * ci + ((rest < ci) ? rest : ci);
+}
+
+int global_fp_rta(global_table_t *table, const U32_T order[]) {
+    U32_T j, k, ok, oj;
+    U64_T r, next, cap, sum, w;
+
+    if(table->overrun)
+        return FALSE;
+
+    for(k = 0; k < table->numServices; k++)
+    {
+        ok = (order != NULL) ? order[k] : k;
+        r  = table->wcet[ok];
+
+        // done the instant it is released, and brings no work into anyone's window
+        if(r == 0)
+        {
+            table->resp[ok] = 0;
+            continue;
+        }
+
+        // the iterates only grow, stop as soon as the clamped deadline is passed
+        while(1)
+        {
+            cap = r - table->wcet[ok] + 1;
+            sum = 0;
+
+            for(j = 0; j < k; j++)
+            {
+                oj   = (order != NULL) ? order[j] : j;
+                w    = fp_workload(table->period[oj], table->wcet[oj], table->resp[oj], r);
+                sum += (w < cap) ? w : cap;
+            }
+
+            next = table->wcet[ok] + sum / table->numCores;
+            if(next == r)
+                break;
+
+            r = next;
+            if(r > table->deadline[ok])
+                break;
+        }
+
+        table->resp[ok] = (r > 0xFFFFFFFFull) ? 0xFFFFFFFFu : (U32_T)r;
+        if(r > table->deadline[ok])
+            return FALSE;
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,77 @@
+/**
+ *  @name   global
+ *  @brief  sufficient schedulability tests for global multiprocessor EDF and fixed priority
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Goossens, Joel, Shelby Funk, and Sanjoy Baruah. "Priority-driven scheduling of periodic task
+ *          systems on multiprocessors." Real-Time Systems 25.2 (2003): 187-205.
+ *  @cite   Bertogna, Marko, Michele Cirinei, and Giuseppe Lipari. "Improved schedulability analysis of EDF
+ *          on multiprocessor platforms." ECRTS 2005: 209-218.
+ *  @cite   Bertogna, Marko, and Michele Cirinei. "Response-time analysis for globally scheduled symmetric
+ *          multiprocessor platforms." RTSS 2007: 149-160.
+*/
+
+#ifndef GLOBAL_H
+#define GLOBAL_H
+
+#include "feasibility.h"
+
+/**
+ *  Per-service terms every global test needs, built once per set and shared by all three.
+ *  Deadlines are clamped to min(D, T), which keeps the one-job-per-period workload bounds
+ *  the tests are built on sound for D > T services at the price of some pessimism.
+*/
+typedef struct {
+    U32_T   numServices;
+    U32_T   numCores;
+    U32_T   capacity;
+    const U32_T *period;
+    const U32_T *wcet;
+    U32_T   *deadline;      // min(D, T)
+    U32_T   *resp;          // global fixed priority response times, indexed like the input
+    U64_T   *bcl;           // sum over i != k of min(BCL EDF interference of i on k, D - C + 1)
+    double  density;        // sum of C/min(D, T)
+    double  maxDensity;
+    int     overrun;        // some service has C > min(D, T), every global test fails
+} global_table_t;
+
+void global_table_init(global_table_t *table);
+void global_table_free(global_table_t *table);
+
+/**
+ *  @brief  precompute the shared terms for one set on numCores processors, O(n^2)
+ *
+ *  The arrays are referenced, not copied, and must outlive the tests run on the table.
+ *
+ *  @return 0 on success, -1 if numCores is 0 or the table could not grow to numServices
+*/
+int global_table_build(global_table_t *table, U32_T numServices, const U32_T period[],
+                       const U32_T wcet[], const U32_T deadline[], U32_T numCores);
+
+/**
+ *  @brief  GFB density bound for global EDF, sum C/D <= M - (M - 1) * max C/D
+*/
+int global_edf_gfb(const global_table_t *table);
+
+/**
+ *  @brief  BCL window test for global EDF
+ *
+ *  Service k passes when the interference every other service can put into its window,
+ *  each capped at D(k) - C(k) + 1, stays below M * (D(k) - C(k) + 1).
+*/
+int global_edf_bcl(const global_table_t *table);
+
+/**
+ *  @brief  Bertogna and Cirinei response time analysis for global fixed priority
+ *
+ *  R(k) = C(k) + floor(sum_i<k min(W(i, R(k)), R(k) - C(k) + 1) / M), where W bounds the
+ *  work of a higher priority service in the window using its own R as carry-in. Writes the
+ *  response times to table->resp and stops at the first service past its deadline.
+ *
+ *  @param  order   level order as from priority_order, NULL takes the arrays as given
+*/
+int global_fp_rta(global_table_t *table, const U32_T order[]);
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ *  @name   instrument
+ *  @brief  thread local counters behind the FEAS_TRACE_* hooks
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "instrument.h"
+
+// each thread counts into its own copy, the shared totals are only touched on a flush
+static __thread feas_stats_t local;
+static feas_stats_t total;
+static pthread_mutex_t totalLock = PTHREAD_MUTEX_INITIALIZER;
+static feas_trace_hook_t traceHook = NULL;
+
+static inline U32_T hist_bucket(U64_T value) {
+    U32_T b;
+
+    if(value == 0)
+        return 0;
+
+    b = 64 - (U32_T)__builtin_clzll(value);
+    return (b < FEAS_HIST_BUCKETS) ? b : FEAS_HIST_BUCKETS - 1;
+}
+
+static void stats_add(feas_stats_t *into, const feas_stats_t *from) {
+    U32_T t, k;
+
+    for(t = 0; t < FEAS_TEST_COUNT; t++)
+    {
+        into->test[t].calls  += from->test[t].calls;
+        into->test[t].cycles += from->test[t].cycles;
+        into->test[t].work   += from->test[t].work;
+        for(k = 0; k < FEAS_EXIT_COUNT; k++)
+            into->test[t].exits[k] += from->test[t].exits[k];
+        for(k = 0; k < FEAS_HIST_BUCKETS; k++)
+        {
+            into->test[t].cycleHist[k] += from->test[t].cycleHist[k];
+            into->test[t].workHist[k]  += from->test[t].workHist[k];
+        }
+    }
+
+    for(k = 0; k < FEAS_EVENT_COUNT; k++)
+        into->events[k] += from->events[k];
+}
+
+U64_T feas_trace_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (U64_T)now.tv_sec * 1000000000ull + (U64_T)now.tv_nsec;
+#endif
+}
+
+void feas_trace_end(int test, int exit, U32_T numServices, U64_T start, U64_T work) {
+    feas_test_stats_t *stats = &local.test[test];
+    U64_T cycles = feas_trace_clock() - start;
+
+    stats->calls++;
+    stats->exits[exit]++;
+    stats->cycles += cycles;
+    stats->cycleHist[hist_bucket(cycles)]++;
+
+    // per call work for tests without per service hooks
+    if(test == FEAS_TEST_EDF)
+    {
+        stats->work += work;
+        stats->workHist[hist_bucket(work)]++;
+    }
+
+    if(traceHook != NULL)
+        traceHook(test, exit, numServices, cycles, work);
+}
+
+void feas_trace_task(int test, U64_T work) {
+    local.test[test].work += work;
+    local.test[test].workHist[hist_bucket(work)]++;
+}
+
+void feas_trace_event(int event) {
+    local.events[event]++;
+}
+
+void feas_trace_set_hook(feas_trace_hook_t hook) {
+    traceHook = hook;
+}
+
+void feas_stats_flush(void) {
+    pthread_mutex_lock(&totalLock);
+    stats_add(&total, &local);
+    pthread_mutex_unlock(&totalLock);
+    memset(&local, 0, sizeof(local));
+}
+
+void feas_stats_snapshot(feas_stats_t *out) {
+    pthread_mutex_lock(&totalLock);
+    *out = total;
+    pthread_mutex_unlock(&totalLock);
+    stats_add(out, &local);
+}
+
+void feas_stats_reset(void) {
+    pthread_mutex_lock(&totalLock);
+    memset(&total, 0, sizeof(total));
+    pthread_mutex_unlock(&totalLock);
+    memset(&local, 0, sizeof(local));
+}
+
+int feas_instrumented(void) {
+#ifdef FEAS_INSTRUMENT
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
@@ -0,0 +1,110 @@
+/**
+ *  @name   instrument
+ *  @brief  optional per test counters, histograms and a tracing hook for the exact kernels
+ *
+ *  Build with -DFEAS_INSTRUMENT (make INSTRUMENT=1) to turn the FEAS_TRACE_* hooks in the
+ *  kernels on. Without it every hook expands to nothing and the kernels are unchanged, the
+ *  functions below still link but only ever see zeroed statistics.
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include "feasibility.h"
+
+// instrumented tests
+#define FEAS_TEST_RTA       0   // completion time, response_time_analysis and friends
+#define FEAS_TEST_SP        1   // scheduling point
+#define FEAS_TEST_EDF       2   // EDF processor demand
+#define FEAS_TEST_COUNT     3
+
+// why a test call returned
+#define FEAS_EXIT_FEASIBLE  0   // every service checked and met its deadline
+#define FEAS_EXIT_MISS      1   // a fixed point, point set or demand walk found a miss
+#define FEAS_EXIT_PRUNED    2   // SP sum C past the horizon, or EDF C > D, before any point
+#define FEAS_EXIT_UTIL      3   // EDF, U > 1
+#define FEAS_EXIT_SHORTCUT  4   // EDF, D >= T for every service, U <= 1 is exact
+#define FEAS_EXIT_OVERFLOW  5   // EDF, the hyperperiod horizon does not fit 64 bits
+#define FEAS_EXIT_COUNT     6
+
+// events counted once per occurrence
+#define FEAS_EVENT_WIDE     0   // a set took the 64 bit path, see feasibility_fits_32
+#define FEAS_EVENT_FALLBACK 1   // a point set outgrew the scratch and fell back to the fixed point
+#define FEAS_EVENT_COUNT    2
+
+// log2 buckets, bucket 0 holds 0, bucket b > 0 holds [2^(b-1), 2^b)
+#define FEAS_HIST_BUCKETS   40
+
+typedef struct {
+    U64_T   calls;
+    U64_T   exits[FEAS_EXIT_COUNT];
+    U64_T   cycles;                         // time stamp counter ticks over all calls
+    U64_T   cycleHist[FEAS_HIST_BUCKETS];   // ticks per call
+    U64_T   work;                           // fixed point passes, points or QPA steps
+    U64_T   workHist[FEAS_HIST_BUCKETS];    // per service for RTA and SP, per call for EDF
+} feas_test_stats_t;
+
+typedef struct {
+    feas_test_stats_t   test[FEAS_TEST_COUNT];
+    U64_T               events[FEAS_EVENT_COUNT];
+} feas_stats_t;
+
+/**
+ *  Called at the end of every instrumented test call on the calling thread, work is the
+ *  total for the call. Keep it cheap, it runs on the analysis thread between test calls.
+*/
+typedef void (*feas_trace_hook_t)(int test, int exit, U32_T numServices, U64_T cycles,
+                                  U64_T work);
+
+/**
+ *  @brief  install a hook, or NULL to remove it, before any analysis threads start
+*/
+void feas_trace_set_hook(feas_trace_hook_t hook);
+
+/**
+ *  @brief  fold the calling thread's counters into the process totals and zero them
+ *
+ *  Pool workers flush before they exit, any other analysis thread should too.
+*/
+void feas_stats_flush(void);
+
+/**
+ *  @brief  process totals plus the calling thread's unflushed counters
+*/
+void feas_stats_snapshot(feas_stats_t *out);
+
+/**
+ *  @brief  zero the process totals and the calling thread's counters
+*/
+void feas_stats_reset(void);
+
+/**
+ *  @brief  TRUE when the kernels were built with FEAS_INSTRUMENT
+*/
+int feas_instrumented(void);
+
+// entry points for the hooks below, not meant to be called directly
+U64_T feas_trace_clock(void);
+void feas_trace_end(int test, int exit, U32_T numServices, U64_T start, U64_T work);
+void feas_trace_task(int test, U64_T work);
+void feas_trace_event(int event);
+
+#ifdef FEAS_INSTRUMENT
+#define FEAS_TRACE_BEGIN()                  U64_T feasTraceStart = feas_trace_clock()
+#define FEAS_TRACE_END(test, exit, n, work) feas_trace_end(test, exit, n, feasTraceStart, work)
+#define FEAS_TRACE_TASK(test, work)         feas_trace_task(test, work)
+#define FEAS_TRACE_EVENT(event)             feas_trace_event(event)
+#define FEAS_TRACE_FLUSH()                  feas_stats_flush()
+#else
+// sizeof keeps the operands referenced without evaluating them
+#define FEAS_TRACE_BEGIN()                  ((void)0)
+#define FEAS_TRACE_END(test, exit, n, work) ((void)sizeof(work))
+#define FEAS_TRACE_TASK(test, work)         ((void)sizeof(work))
+#define FEAS_TRACE_EVENT(event)             ((void)0)
+#define FEAS_TRACE_FLUSH()                  ((void)0)
+#endif
+
+#endif
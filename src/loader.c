@@ -0,0 +1,281 @@
+/**
+ *  @name   loader
+ *  @brief  streaming task set reader for text and binary inputs into a reusable arena
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+
+#include "loader.h"
+
+void taskset_arena_init(taskset_arena_t *arena) {
+    memset(arena, 0, sizeof(*arena));
+}
+
+void taskset_arena_free(taskset_arena_t *arena) {
+    free(arena->offset);
+    free(arena->period);
+    free(arena->wcet);
+    free(arena->deadline);
+    memset(arena, 0, sizeof(*arena));
+}
+
+void taskset_arena_reset(taskset_arena_t *arena) {
+    arena->numSets  = 0;
+    arena->numTasks = 0;
+}
+
+static int grow(U32_T **col, U32_T capacity) {
+    U32_T *p = realloc(*col, sizeof(U32_T) * capacity);
+
+    if(p == NULL)
+        return -1;
+
+    *col = p;
+    return 0;
+}
+
+// new services are written straight past the arena's used tasks, then committed as one set.
+// extra can come straight from the input, so the sum is checked before it is formed
+static int reserve_tasks(taskset_arena_t *arena, U32_T extra) {
+    U32_T need, cap;
+
+    if(extra > LOADER_MAX_TASKS - arena->numTasks)
+        return -1;
+
+    need = arena->numTasks + extra;
+    if(need <= arena->taskCapacity)
+        return 0;
+
+    cap = arena->taskCapacity ? arena->taskCapacity : 4096;
+    while(cap < need)
+        cap = (cap > LOADER_MAX_TASKS / 2) ? LOADER_MAX_TASKS : cap * 2;
+    if(grow(&arena->period, cap) != 0 || grow(&arena->wcet, cap) != 0 ||
+       grow(&arena->deadline, cap) != 0)
+        return -1;
+    arena->taskCapacity = cap;
+
+    return 0;
+}
+
+static int commit_tasks(taskset_arena_t *arena, U32_T numServices) {
+    // offset carries one extra entry for the end of the last set
+    if(arena->numSets + 2 > arena->setCapacity)
+    {
+        U32_T cap = arena->setCapacity ? arena->setCapacity * 2 : 1024;
+
+        if(grow(&arena->offset, cap) != 0)
+            return -1;
+        arena->setCapacity = cap;
+    }
+
+    arena->offset[arena->numSets] = arena->numTasks;
+    arena->numTasks += numServices;
+    arena->numSets++;
+    arena->offset[arena->numSets] = arena->numTasks;
+
+    return 0;
+}
+
+int taskset_arena_push(taskset_arena_t *arena, U32_T numServices, const U32_T period[],
+                       const U32_T wcet[], const U32_T deadline[]) {
+    if(reserve_tasks(arena, numServices) != 0)
+        return -1;
+
+    memcpy(arena->period + arena->numTasks, period, sizeof(U32_T) * numServices);
+    memcpy(arena->wcet + arena->numTasks, wcet, sizeof(U32_T) * numServices);
+    memcpy(arena->deadline + arena->numTasks, deadline, sizeof(U32_T) * numServices);
+
+    return commit_tasks(arena, numServices);
+}
+
+int taskset_arena_reserve(taskset_arena_t *arena, U32_T numSets, U32_T numTasks) {
+    U32_T cap;
+
+    if(numTasks > arena->numTasks && reserve_tasks(arena, numTasks - arena->numTasks) != 0)
+        return -1;
+
+    if(numSets + 1 > arena->setCapacity)
+    {
+        cap = arena->setCapacity ? arena->setCapacity : 1024;
+        while(cap < numSets + 1)
+            cap *= 2;
+        if(grow(&arena->offset, cap) != 0)
+            return -1;
+        arena->setCapacity = cap;
+    }
+
+    return 0;
+}
+
+void taskset_arena_batch(const taskset_arena_t *arena, taskset_batch_t *batch) {
+    static const U32_T empty = 0;
+
+    batch->numSets  = arena->numSets;
+    batch->offset   = arena->offset ? arena->offset : &empty;
+    batch->period   = arena->period;
+    batch->wcet     = arena->wcet;
+    batch->deadline = arena->deadline;
+}
+
+void loader_init(loader_t *loader, FILE *in, int format) {
+    memset(loader, 0, sizeof(*loader));
+    loader->in     = in;
+    loader->format = format;
+}
+
+void loader_free(loader_t *loader) {
+    free(loader->buf);
+    loader->buf = NULL;
+    loader->bufSize = 0;
+}
+
+// strtoul without locale or errno, rejects anything that does not fit U32_T
+static const char *parse_u32(const char *p, U32_T *value) {
+    unsigned long long v = 0;
+    const char *start = p;
+
+    while(*p >= '0' && *p <= '9')
+    {
+        v = v * 10 + (U32_T)(*p - '0');
+        if(v > 0xFFFFFFFFull)
+            return NULL;
+        p++;
+    }
+
+    if(p == start)
+        return NULL;
+
+    *value = (U32_T)v;
+    return p;
+}
+
+static int parse_line(loader_t *loader, taskset_arena_t *arena, const char *p) {
+    U32_T n = 0, t, c, d, base = arena->numTasks;
+
+    while(1)
+    {
+        while(*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')
+            p++;
+        if(*p == '\0' || *p == '#')
+            break;
+
+        if((p = parse_u32(p, &t)) == NULL || *p++ != ':' || (p = parse_u32(p, &c)) == NULL)
+            goto malformed;
+
+        d = t;
+        if(*p == ':' && (p = parse_u32(p + 1, &d)) == NULL)
+            goto malformed;
+
+        if(t == 0)
+        {
+            snprintf(loader->error, sizeof(loader->error), "line %zu: period must be non-zero", loader->line);
+            return -1;
+        }
+
+        if(reserve_tasks(arena, n + 1) != 0)
+        {
+            snprintf(loader->error, sizeof(loader->error), "line %zu: out of memory or too many services",
+                     loader->line);
+            return -1;
+        }
+        arena->period[base + n]   = t;
+        arena->wcet[base + n]     = c;
+        arena->deadline[base + n] = d;
+        n++;
+    }
+
+    // blank and comment-only lines are not sets
+    if(n == 0)
+        return 0;
+
+    if(commit_tasks(arena, n) != 0)
+    {
+        snprintf(loader->error, sizeof(loader->error), "line %zu: out of memory", loader->line);
+        return -1;
+    }
+    return 1;
+
+malformed:
+    snprintf(loader->error, sizeof(loader->error), "line %zu: expected T:C or T:C:D", loader->line);
+    return -1;
+}
+
+static int read_binary_set(loader_t *loader, taskset_arena_t *arena) {
+    U32_T n, k, rec[3], base;
+
+    if(fread(&n, sizeof(n), 1, loader->in) != 1)
+        return 0;
+
+    loader->line++;
+    if(n > LOADER_MAX_TASKS - arena->numTasks)
+    {
+        snprintf(loader->error, sizeof(loader->error), "record %zu: %u services is past the limit",
+                 loader->line, n);
+        return -1;
+    }
+
+    // n is only a claim until its records arrive, so the arena grows with them
+    base = arena->numTasks;
+    for(k = 0; k < n; k++)
+    {
+        if(fread(rec, sizeof(U32_T), 3, loader->in) != 3)
+        {
+            snprintf(loader->error, sizeof(loader->error), "record %zu: truncated", loader->line);
+            return -1;
+        }
+        if(reserve_tasks(arena, k + 1) != 0)
+        {
+            snprintf(loader->error, sizeof(loader->error), "record %zu: out of memory", loader->line);
+            return -1;
+        }
+        if(rec[0] == 0)
+        {
+            snprintf(loader->error, sizeof(loader->error), "record %zu: period must be non-zero", loader->line);
+            return -1;
+        }
+        arena->period[base + k]   = rec[0];
+        arena->wcet[base + k]     = rec[1];
+        arena->deadline[base + k] = rec[2];
+    }
+
+    if(commit_tasks(arena, n) != 0)
+    {
+        snprintf(loader->error, sizeof(loader->error), "record %zu: out of memory", loader->line);
+        return -1;
+    }
+    return 1;
+}
+
+int loader_next(loader_t *loader, taskset_arena_t *arena, U32_T maxSets) {
+    ssize_t len;
+    int rc;
+
+    taskset_arena_reset(arena);
+
+    while(arena->numSets < maxSets)
+    {
+        if(loader->format == LOADER_BINARY)
+        {
+            rc = read_binary_set(loader, arena);
+        }
+        else
+        {
+            if((len = getline(&loader->buf, &loader->bufSize, loader->in)) < 0)
+                break;
+            loader->line++;
+            rc = parse_line(loader, arena, loader->buf);
+        }
+
+        if(rc < 0)
+            return -1;
+        if(rc == 0 && loader->format == LOADER_BINARY)
+            break;
+    }
+
+    return (int)arena->numSets;
+}
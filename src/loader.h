@@ -0,0 +1,90 @@
+/**
+ *  @name   loader
+ *  @brief  streaming task set reader for text and binary inputs into a reusable arena
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  Text format, one task set per line, services listed highest priority first:
+ *
+ *      # comment, blank lines are skipped
+ *      2:1 10:1 15:2           T:C pairs, D defaults to T
+ *      3:1:3 5:2:4 15:3:15     T:C:D triples, both forms can be mixed on a line
+ *
+ *  Binary format, a stream of fixed records in host byte order:
+ *
+ *      U32 n, then n times { U32 period, U32 wcet, U32 deadline }
+*/
+
+#ifndef LOADER_H
+#define LOADER_H
+
+#include <stdio.h>
+
+#include "batch.h"
+
+#define LOADER_TEXT     0
+#define LOADER_BINARY   1
+
+// most services an arena holds across its sets, 3 GiB of columns, a set past it is rejected
+#define LOADER_MAX_TASKS    (1u << 28)
+
+/**
+ *  Growable structure-of-arrays storage for a chunk of sets. Reset between chunks keeps
+ *  the allocations, so a steady stream stops allocating once the largest chunk is seen.
+*/
+typedef struct {
+    U32_T   numSets, setCapacity;
+    U32_T   numTasks, taskCapacity;
+    U32_T   *offset;
+    U32_T   *period;
+    U32_T   *wcet;
+    U32_T   *deadline;
+} taskset_arena_t;
+
+typedef struct {
+    FILE    *in;
+    int     format;
+    size_t  line;
+    char    *buf;
+    size_t  bufSize;
+    char    error[128];
+} loader_t;
+
+void taskset_arena_init(taskset_arena_t *arena);
+void taskset_arena_free(taskset_arena_t *arena);
+void taskset_arena_reset(taskset_arena_t *arena);
+
+/**
+ *  @brief  append one set, the arrays are copied
+ *
+ *  @return 0 on success, -1 if the arena could not grow or would pass LOADER_MAX_TASKS
+*/
+int taskset_arena_push(taskset_arena_t *arena, U32_T numServices, const U32_T period[],
+                       const U32_T wcet[], const U32_T deadline[]);
+
+/**
+ *  @brief  make room for numSets sets of numTasks services in all without changing the contents,
+ *          for producers that write offset[] and the columns themselves
+ *
+ *  @return 0 on success, -1 if the arena could not grow or would pass LOADER_MAX_TASKS
+*/
+int taskset_arena_reserve(taskset_arena_t *arena, U32_T numSets, U32_T numTasks);
+
+/**
+ *  @brief  batch view over the sets currently in the arena, valid until the next push or reset
+*/
+void taskset_arena_batch(const taskset_arena_t *arena, taskset_batch_t *batch);
+
+void loader_init(loader_t *loader, FILE *in, int format);
+void loader_free(loader_t *loader);
+
+/**
+ *  @brief  reset the arena and read up to maxSets sets into it
+ *
+ *  @return number of sets read, 0 at end of input, -1 on a malformed input with
+ *          loader->error describing it
+*/
+int loader_next(loader_t *loader, taskset_arena_t *arena, U32_T maxSets);
+
+#endif
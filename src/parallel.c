@@ -0,0 +1,103 @@
+/**
+ *  @name   parallel
+ *  @brief  multithreaded drivers for batch sweeps and single large task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stddef.h>
+
+#include "parallel.h"
+#include "pool.h"
+
+// sets per chunk, large enough to amortize the pool lock and keep the screen vectors full
+#define BATCH_GRAIN     256
+
+// services per chunk of one big set, each chunk pays one cold start
+#define SERVICE_GRAIN   64
+
+typedef struct {
+    const taskset_batch_t   *batch;
+    const batch_config_t    *config;
+    feasibility_result_t    *results;
+    feas_workspace_t        *workspace;     // one per worker
+    volatile int            failed;
+} batch_job_t;
+
+typedef struct {
+    const U32_T     *period;
+    const U32_T     *wcet;
+    const U32_T     *deadline;
+    U32_T           *resp;
+    volatile int    missed;
+} rta_job_t;
+
+static void batch_chunk(void *ctx, U32_T first, U32_T last, U32_T worker) {
+    batch_job_t *job = (batch_job_t *)ctx;
+
+    if(feasibility_batch_range_ws(job->batch, job->config, &job->workspace[worker], first, last,
+                                  job->results) != 0)
+        __atomic_store_n(&job->failed, TRUE, __ATOMIC_RELAXED);
+}
+
+int feasibility_batch_parallel(const taskset_batch_t *batch, const batch_config_t *config,
+                               feasibility_result_t results[], U32_T numThreads) {
+    batch_job_t job = { batch, config, results, NULL, FALSE };
+    U32_T owned = 0;
+    int rc;
+
+    if(numThreads == 0)
+        numThreads = pool_default_threads();
+
+    // workers index the workspaces by id, so the config's only do if there is one for each
+    if(config != NULL && config->numWorkspaces >= numThreads)
+        job.workspace = config->workspace;
+    else
+    {
+        if((job.workspace = workspace_array(numThreads)) == NULL)
+            return -1;
+        owned = numThreads;
+    }
+
+    rc = pool_parallel_for(batch->numSets, BATCH_GRAIN, numThreads, batch_chunk, &job);
+
+    workspace_array_free((owned > 0) ? job.workspace : NULL, owned);
+    return (rc != 0 || job.failed) ? -1 : 0;
+}
+
+static void rta_chunk(void *ctx, U32_T first, U32_T last, U32_T worker) {
+    rta_job_t *job = (rta_job_t *)ctx;
+    U32_T i, an = 0;
+
+    (void)worker;
+    if(job->missed)
+        return;
+
+    for(i = 0; i < first; i++)
+        an += job->wcet[i];
+
+    for(i = first; i < last; i++)
+    {
+        an = response_time_service(i, job->period, job->wcet, job->deadline, an + job->wcet[i]);
+
+        if(job->resp != NULL)
+            job->resp[i] = an;
+
+        if(an > job->deadline[i])
+        {
+            __atomic_store_n(&job->missed, TRUE, __ATOMIC_RELAXED);
+            return;
+        }
+    }
+}
+
+int response_time_analysis_parallel(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], U32_T resp[], U32_T numThreads) {
+    rta_job_t job = { period, wcet, deadline, resp, FALSE };
+
+    if(pool_parallel_for(numServices, SERVICE_GRAIN, numThreads, rta_chunk, &job) != 0)
+        return response_time_analysis(numServices, period, wcet, deadline, resp);
+
+    return job.missed ? FALSE : TRUE;
+}
@@ -0,0 +1,40 @@
+/**
+ *  @name   parallel
+ *  @brief  multithreaded drivers for batch sweeps and single large task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "batch.h"
+
+/**
+ *  @brief  feasibility_batch_range over the whole batch spread over numThreads work stealing
+ *          workers, 0 uses every core
+ *
+ *  Worker k runs its chunks in config->workspace[k] when the config carries a workspace for
+ *  every worker, otherwise in workspaces set up for this call.
+ *
+ *  @param  config  analysis options, may be NULL
+ *
+ *  @return 0 on success, -1 if the thread pool could not be set up or a chunk ran out of memory
+*/
+int feasibility_batch_parallel(const taskset_batch_t *batch, const batch_config_t *config,
+                               feasibility_result_t results[], U32_T numThreads);
+
+/**
+ *  @brief  response_time_analysis with the per-service fixed points split across workers
+ *
+ *  Every chunk seeds its first service from C(0) + ... + C(i) and warm starts the rest of the
+ *  chunk from there. Workers stop picking up services once any deadline miss is seen, so on a
+ *  FALSE result resp[] is only partially written.
+ *
+ *  @return TRUE if every service meets its deadline, FALSE otherwise
+*/
+int response_time_analysis_parallel(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], U32_T resp[], U32_T numThreads);
+
+#endif
@@ -0,0 +1,215 @@
+/**
+ *  @name   partition
+ *  @brief  partitioned multi-core RM, bin-packing services onto cores with per-core admission
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "exact.h"
+#include "partition.h"
+
+// services a core starts with, doubled whenever it fills up
+#define PART_CORE_START 16
+
+int partition_init(partition_t *part, U32_T numCores) {
+    U32_T c;
+
+    memset(part, 0, sizeof(*part));
+
+    part->core        = calloc(numCores, sizeof(admission_ctx_t));
+    part->hyper       = malloc(sizeof(double) * numCores);
+    part->constrained = malloc(sizeof(U32_T) * numCores);
+    part->rank        = malloc(sizeof(U32_T) * numCores);
+    part->numCores    = numCores;
+
+    if(!part->core || !part->hyper || !part->constrained || !part->rank)
+    {
+        partition_destroy(part);
+        return -1;
+    }
+
+    for(c = 0; c < numCores; c++)
+    {
+        if(admission_init(&part->core[c], PART_CORE_START) != 0)
+        {
+            partition_destroy(part);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void partition_destroy(partition_t *part) {
+    U32_T c;
+
+    // admission_destroy is safe on the zeroed contexts calloc left behind a failed init
+    if(part->core != NULL)
+        for(c = 0; c < part->numCores; c++)
+            admission_destroy(&part->core[c]);
+
+    free(part->core);
+    free(part->hyper);
+    free(part->constrained);
+    free(part->rank);
+    free(part->items);
+    memset(part, 0, sizeof(*part));
+}
+
+// decreasing utilization, ties by index so every platform packs the same way
+static int item_compare(const void *a, const void *b) {
+    const partition_item_t *x = a, *y = b;
+
+    if(x->util != y->util)
+        return (x->util > y->util) ? -1 : 1;
+
+    return (x->index < y->index) ? -1 : (x->index > y->index);
+}
+
+// cheap bounds first, the incremental completion test only when they cannot decide and exact
+// is set, FALSE otherwise
+static int core_offer(partition_t *part, U32_T c, U32_T period, U32_T wcet, U32_T deadline,
+                      double u, int exact) {
+    admission_ctx_t *ctx = &part->core[c];
+    double load = ctx->utilization + u;
+    U32_T n = ctx->count + 1;
+    int rc;
+
+    if(ctx->count == ctx->capacity && admission_reserve(ctx, 2 * ctx->capacity) != 0)
+        return -1;
+
+    // the bounds are decided exactly on the grown set, so the offer sits in the first free
+    // slot, where admitting it overwrites it again
+    ctx->period[ctx->count] = period;
+    ctx->wcet[ctx->count]   = wcet;
+
+    if(exact_util_compare_from(n, ctx->period, ctx->wcet, load) > 0)
+        return FALSE;
+
+    if(part->constrained[c] == 0 && deadline >= period &&
+       (exact_lub_compare_from(n, ctx->period, ctx->wcet, load) <= 0 ||
+        exact_hyperbolic_compare_from(n, ctx->period, ctx->wcet, part->hyper[c] * (u + 1.0)) <= 0))
+        rc = admission_place(ctx, period, wcet, deadline, NULL);
+    else if(exact)
+        rc = admission_add(ctx, period, wcet, deadline, NULL);
+    else
+        rc = FALSE;
+
+    if(rc == TRUE)
+    {
+        part->hyper[c] *= u + 1.0;
+        if(deadline < period)
+            part->constrained[c]++;
+    }
+
+    return rc;
+}
+
+// a core only ever gains load, so bubbling it toward the front keeps rank sorted
+static void rank_raise(partition_t *part, U32_T r) {
+    U32_T c = part->rank[r];
+    double load = part->core[c].utilization;
+
+    while(r > 0 && part->core[part->rank[r - 1]].utilization < load)
+    {
+        part->rank[r] = part->rank[r - 1];
+        r--;
+    }
+
+    part->rank[r] = c;
+}
+
+int partition_assign(partition_t *part, U32_T numServices, const U32_T period[],
+                     const U32_T wcet[], const U32_T deadline[], int heuristic, U32_T core_of[]) {
+    partition_item_t *grown;
+    U32_T i, k, r, c, placed = 0;
+    int fit = heuristic & ~PART_BOUNDS_FIRST;
+    int rc, exact;
+
+    if(numServices > part->itemCapacity)
+    {
+        grown = realloc(part->items, sizeof(partition_item_t) * numServices);
+        if(grown == NULL)
+            return -1;
+        part->items        = grown;
+        part->itemCapacity = numServices;
+    }
+
+    for(c = 0; c < part->numCores; c++)
+    {
+        admission_clear(&part->core[c]);
+        part->hyper[c]       = 1.0;
+        part->constrained[c] = 0;
+        part->rank[c]        = c;
+    }
+
+    for(i = 0; i < numServices; i++)
+    {
+        part->items[i].util  = (double)wcet[i] / (double)period[i];
+        part->items[i].index = i;
+    }
+    qsort(part->items, numServices, sizeof(partition_item_t), item_compare);
+
+    for(k = 0; k < numServices; k++)
+    {
+        i  = part->items[k].index;
+        rc = FALSE;
+
+        // a bounds only sweep over every core before any of them pays for a completion test
+        for(exact = !(heuristic & PART_BOUNDS_FIRST); exact <= TRUE && rc != TRUE; exact++)
+        {
+            for(r = 0; r < part->numCores; r++)
+            {
+                if(fit == PART_FIRST_FIT)
+                    c = r;
+                else if(fit == PART_BEST_FIT)
+                    c = part->rank[r];
+                else
+                    c = part->rank[part->numCores - 1 - r];
+
+                rc = core_offer(part, c, period[i], wcet[i], deadline[i], part->items[k].util,
+                                exact);
+                if(rc == -1)
+                    return -1;
+                if(rc == TRUE)
+                    break;
+            }
+        }
+
+        if(rc != TRUE)
+        {
+            core_of[i] = PART_NONE;
+            continue;
+        }
+
+        core_of[i] = c;
+        placed++;
+
+        // first fit never looks at the ranking, no need to maintain it
+        if(fit != PART_FIRST_FIT)
+            rank_raise(part, (fit == PART_BEST_FIT) ? r : part->numCores - 1 - r);
+    }
+
+    return (int)placed;
+}
+
+int partition_pin_thread(pthread_t thread, U32_T core) {
+    cpu_set_t set;
+
+    if(core >= CPU_SETSIZE)
+        return EINVAL;
+
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+
+    return pthread_setaffinity_np(thread, sizeof(set), &set);
+}
@@ -0,0 +1,85 @@
+/**
+ *  @name   partition
+ *  @brief  partitioned multi-core RM, bin-packing services onto cores with per-core admission
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Dhall, Sudarshan K., and Chung Laung Liu. "On a real-time scheduling problem."
+ *          Operations research 26.1 (1978): 127-140.
+ *  @cite   Burchard, Almut, et al. "New strategies for assigning real-time tasks to multiprocessor
+ *          systems." IEEE transactions on computers 44.12 (1995): 1429-1442.
+*/
+
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include <pthread.h>
+
+#include "admission.h"
+#include "feasibility.h"
+
+// bin-packing heuristics, services are always offered in decreasing utilization order
+#define PART_FIRST_FIT  0   // lowest numbered core that accepts
+#define PART_BEST_FIT   1   // most loaded core that accepts
+#define PART_WORST_FIT  2   // least loaded core that accepts
+
+// or'ed into a heuristic, try every core on the bounds alone before any completion test,
+// trading a little packing density for almost never running the exact analysis
+#define PART_BOUNDS_FIRST   0x100
+
+// core_of entry of a service no core could accept
+#define PART_NONE       0xFFFFFFFFu
+
+typedef struct {
+    double          util;
+    U32_T           index;
+} partition_item_t;
+
+/**
+ *  One admission context per core, kept between calls so repeated partitioning never
+ *  reallocates once the cores have grown to the working set.
+*/
+typedef struct {
+    U32_T           numCores;
+    admission_ctx_t *core;
+    double          *hyper;         // prod (U(i) + 1) of the services on each core
+    U32_T           *constrained;   // services with D < T on each core, the bounds need none
+    U32_T           *rank;          // cores by decreasing load, for best and worst fit
+    partition_item_t *items;        // services by decreasing utilization
+    U32_T           itemCapacity;
+} partition_t;
+
+/**
+ *  @return 0 on success, -1 if the per-core state could not be allocated
+*/
+int partition_init(partition_t *part, U32_T numCores);
+void partition_destroy(partition_t *part);
+
+/**
+ *  @brief  pack every service onto a core so each core passes RM on its own
+ *
+ *  Each offer first rejects on U > 1, then accepts without analysis when the core has only
+ *  D >= T services and passes the Liu and Layland or hyperbolic bound, and only otherwise
+ *  runs the incremental completion test of admission_add. The bounds are decided exactly,
+ *  as in the batch screen, so a core right on one is never rejected by rounding. Bound
+ *  accepted services leave the core's response times stale until an exact test is needed
+ *  there.
+ *
+ *  @param  heuristic   PART_FIRST_FIT, PART_BEST_FIT or PART_WORST_FIT, optionally with
+ *                      PART_BOUNDS_FIRST
+ *  @param  core_of     affinity map, core_of[i] is the core of service i or PART_NONE
+ *
+ *  @return number of services placed (numServices if the whole set fits), -1 if out of memory
+*/
+int partition_assign(partition_t *part, U32_T numServices, const U32_T period[],
+                     const U32_T wcet[], const U32_T deadline[], int heuristic, U32_T core_of[]);
+
+/**
+ *  @brief  pin a thread to one core of the affinity map
+ *
+ *  @return 0 on success, an errno value from pthread_setaffinity_np otherwise
+*/
+int partition_pin_thread(pthread_t thread, U32_T core);
+
+#endif
@@ -0,0 +1,167 @@
+/**
+ *  @name   pool
+ *  @brief  work stealing parallel for over an index range using POSIX threads
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "instrument.h"
+#include "pool.h"
+
+// workers whose state lives on the caller's stack, larger pools allocate it
+#define POOL_STACK_WORKERS  64
+
+typedef struct pool pool_t;
+
+// one per worker, padded to a cache line so owners and thieves do not false share
+typedef struct {
+    pthread_mutex_t lock;
+    U32_T           lo;
+    U32_T           hi;
+    U32_T           id;
+    pool_t          *pool;
+    pthread_t       thread;
+} __attribute__((aligned(64))) pool_worker_t;
+
+struct pool {
+    pool_worker_t   *workers;
+    U32_T           numThreads;
+    U32_T           grain;
+    pool_range_fn   fn;
+    void            *ctx;
+};
+
+U32_T pool_default_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (n > 0) ? (U32_T)n : 1;
+}
+
+// take the next chunk off the front of our own slice
+static int pool_pop(pool_worker_t *w, U32_T *first, U32_T *last) {
+    int rc = FALSE;
+
+    pthread_mutex_lock(&w->lock);
+    if(w->lo < w->hi)
+    {
+        *first = w->lo;
+        *last  = (w->hi - w->lo > w->pool->grain) ? w->lo + w->pool->grain : w->hi;
+        w->lo  = *last;
+        rc = TRUE;
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    return rc;
+}
+
+// move the back half of some victim's slice into ours
+static int pool_steal(pool_worker_t *self) {
+    pool_t *pool = self->pool;
+    U32_T k, lo, hi, mid;
+
+    for(k = 1; k < pool->numThreads; k++)
+    {
+        pool_worker_t *victim = &pool->workers[(self->id + k) % pool->numThreads];
+
+        pthread_mutex_lock(&victim->lock);
+        lo = victim->lo;
+        hi = victim->hi;
+        if(lo >= hi)
+        {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
+        mid = lo + (hi - lo) / 2;
+        victim->hi = mid;
+        pthread_mutex_unlock(&victim->lock);
+
+        pthread_mutex_lock(&self->lock);
+        self->lo = mid;
+        self->hi = hi;
+        pthread_mutex_unlock(&self->lock);
+        return TRUE;
+    }
+
+    // work only ever shrinks, so a full pass over empty victims means we are done
+    return FALSE;
+}
+
+static void *pool_worker(void *arg) {
+    pool_worker_t *w = (pool_worker_t *)arg;
+    U32_T first, last;
+
+    do
+    {
+        while(pool_pop(w, &first, &last))
+            w->pool->fn(w->pool->ctx, first, last, w->id);
+    } while(pool_steal(w));
+
+    // spawned workers exit after this, their counters would go with them
+    if(w->id != 0)
+        FEAS_TRACE_FLUSH();
+
+    return NULL;
+}
+
+int pool_parallel_for(U32_T count, U32_T grain, U32_T numThreads, pool_range_fn fn, void *ctx) {
+    pool_worker_t stackWorkers[POOL_STACK_WORKERS];
+    pool_t pool;
+    U32_T i, started;
+
+    if(numThreads == 0)
+        numThreads = pool_default_threads();
+    if(numThreads > count)
+        numThreads = (count > 0) ? count : 1;
+    if(grain == 0)
+        grain = 1;
+
+    // nothing to share, skip the thread setup entirely
+    if(numThreads == 1)
+    {
+        for(i = 0; i < count; i += grain)
+            fn(ctx, i, (count - i > grain) ? i + grain : count, 0);
+        return 0;
+    }
+
+    pool.workers = (numThreads <= POOL_STACK_WORKERS)
+        ? stackWorkers : aligned_alloc(64, sizeof(pool_worker_t) * numThreads);
+    if(pool.workers == NULL)
+        return -1;
+    pool.numThreads = numThreads;
+    pool.grain      = grain;
+    pool.fn         = fn;
+    pool.ctx        = ctx;
+
+    for(i = 0; i < numThreads; i++)
+    {
+        pthread_mutex_init(&pool.workers[i].lock, NULL);
+        pool.workers[i].lo   = (U32_T)(((unsigned long long)count * i) / numThreads);
+        pool.workers[i].hi   = (U32_T)(((unsigned long long)count * (i + 1)) / numThreads);
+        pool.workers[i].id   = i;
+        pool.workers[i].pool = &pool;
+    }
+
+    for(started = 1; started < numThreads; started++)
+    {
+        // the workers that did start, at least this thread, steal any orphaned slices
+        if(pthread_create(&pool.workers[started].thread, NULL, pool_worker, &pool.workers[started]) != 0)
+            break;
+    }
+
+    pool_worker(&pool.workers[0]);
+
+    for(i = 1; i < started; i++)
+        pthread_join(pool.workers[i].thread, NULL);
+
+    for(i = 0; i < numThreads; i++)
+        pthread_mutex_destroy(&pool.workers[i].lock);
+    if(pool.workers != stackWorkers)
+        free(pool.workers);
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+/**
+ *  @name   pool
+ *  @brief  work stealing parallel for over an index range using POSIX threads
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef POOL_H
+#define POOL_H
+
+#include "feasibility.h"
+
+/**
+ *  Called with a chunk [first, last) of the index space, worker is in [0, numThreads)
+ *  and is stable for the calling thread so it can index per-thread scratch state.
+*/
+typedef void (*pool_range_fn)(void *ctx, U32_T first, U32_T last, U32_T worker);
+
+/**
+ *  @brief  number of online cores, used when a caller asks for 0 threads
+*/
+U32_T pool_default_threads(void);
+
+/**
+ *  @brief  run fn over [0, count) split across numThreads workers
+ *
+ *  Each worker starts with an equal slice and takes grain sized chunks from the front of it.
+ *  A worker that runs dry steals the back half of another worker's remaining slice, so sets
+ *  with very different analysis cost do not leave cores idle. The calling thread is worker 0.
+ *
+ *  @return 0 on success, -1 if the worker state could not be allocated
+*/
+int pool_parallel_for(U32_T count, U32_T grain, U32_T numThreads, pool_range_fn fn, void *ctx);
+
+#endif
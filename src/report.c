@@ -0,0 +1,256 @@
+/**
+ *  @name   report
+ *  @brief  optional human readable reporting on top of the silent feasibility kernels
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <math.h>
+
+#include "edf.h"
+#include "report.h"
+
+int report_rm_lub(FILE *out, U32_T numServices, const U32_T period[], const U32_T wcet[],
+                  const U32_T deadline[]) {
+  double utility_sum=0.0, lub=0.0;
+  U32_T idx;
+  // Sum the C(i) over the T(i)
+  for(idx=0; idx < numServices; idx++)
+  {
+    utility_sum += ((double)wcet[idx] / (double)period[idx]);
+    fprintf(out, "\tS%d, wcet=%.4lf, period=%.4lf, utility_sum = %.4lf\n", idx, (double)wcet[idx], (double)period[idx], utility_sum);
+  }
+  fprintf(out, "\tSystem Utilization = %.4lf\n", utility_sum);
+
+  lub = rm_lub_bound(numServices);
+  fprintf(out, "\tLUB = %.4lf\n", lub);
+
+  // the verdict always comes from the kernel so the report can never disagree with it
+  return rate_monotonic_least_upper_bound(numServices, period, wcet, deadline);
+}
+
+void print_test_results(U32_T numServices, U32_T period[], U32_T wcet[]) {
+    int edf;
+
+    printf("\nCompletion Time:  ");
+    if(completion_time_feasibility(numServices, period, wcet, period) == TRUE)
+        printf("FEASIBLE\n");
+    else
+        printf("INFEASIBLE\n");
+
+    printf("Scheduling Point: ");
+    if(scheduling_point_feasibility(numServices, period, wcet, period) == TRUE)
+        printf("FEASIBLE\n\n");
+    else
+        printf("INFEASIBLE\n\n");
+
+    if(report_rm_lub(stdout, numServices, period, wcet, period) == TRUE)
+        printf("\nRM LUB: FEASIBLE\n");
+    else
+        printf("\nRM LUB: INFEASIBLE\n");
+
+    // LLF is optimal on one core just as EDF is, so the demand analysis decides both
+    edf = edf_demand_feasibility(numServices, period, wcet, period);
+    printf("EDF: \t");
+    if(edf == TRUE)
+        printf("FEASIBLE\n");
+    else
+        printf("INFEASIBLE\n");
+
+    printf("LLF: \t");
+    if(edf == TRUE)
+        printf("FEASIBLE\n");
+    else
+        printf("INFEASIBLE\n");
+}
+
+static const char *verdict(int feasible) {
+    return feasible ? "FEASIBLE" : "INFEASIBLE";
+}
+
+void report_batch(FILE *out, const taskset_batch_t *batch, const feasibility_result_t results[],
+                  U32_T firstId) {
+    U32_T s;
+
+    for(s = 0; s < batch->numSets; s++)
+    {
+        fprintf(out, "set %u n=%u U=%.4f LUB=%.4f RM LUB: %s, Completion Time: %s, Scheduling Point: %s, EDF: %s",
+                firstId + s, batch->offset[s + 1] - batch->offset[s],
+                results[s].utilization, results[s].lub, verdict(results[s].rm_lub),
+                verdict(results[s].completion), verdict(results[s].sched_point),
+                (results[s].edf == FEAS_OVERFLOW) ? "OVERFLOW" : verdict(results[s].edf));
+
+        if(results[s].multicore & BATCH_GLOBAL)
+            fprintf(out, ", GFB: %s, BCL: %s, Global FP: %s", verdict(results[s].gfb),
+                    verdict(results[s].bcl), verdict(results[s].global_fp));
+        if(results[s].multicore & BATCH_PARTITIONED)
+            fprintf(out, ", Partitioned: %s", verdict(results[s].partitioned));
+        fprintf(out, "\n");
+    }
+}
+
+void report_sweep_header(FILE *out, int multicore) {
+    fprintf(out, "# %6s %8s %10s %8s %8s %8s %8s %8s %8s", "n", "U", "sets", "mean_U", "sd_U",
+            "rm_lub", "rta", "sched_pt", "edf");
+    if(multicore)
+        fprintf(out, " %8s %8s %8s %8s", "gfb", "bcl", "glob_fp", "part");
+    fprintf(out, "\n");
+}
+
+void report_sweep_cell(FILE *out, const sweep_cell_t *cell, int multicore) {
+    double sets = (cell->sets > 0) ? (double)cell->sets : 1.0;
+    U32_T k, last = multicore ? SWEEP_TESTS : SWEEP_GFB;
+
+    fprintf(out, "  %6u %8.4f %10llu %8.4f %8.4f", cell->numServices, cell->utilization, cell->sets,
+            cell->meanU, (cell->sets > 1) ? sqrt(cell->m2U / (double)(cell->sets - 1)) : 0.0);
+    for(k = 0; k < last; k++)
+        fprintf(out, " %8.4f", (double)cell->accepted[k] / sets);
+    fprintf(out, "\n");
+}
+
+const char *report_policy_name(int policy) {
+    static const char *names[] = { "RM", "DM", "EDF", "LLF" };
+
+    return (policy >= SIM_RM && policy <= SIM_LLF) ? names[policy] : "?";
+}
+
+void report_schedule(FILE *out, int policy, int verdict, const sim_result_t *result, int analytic) {
+    U32_T k;
+
+    if(verdict == FEAS_OVERFLOW)
+    {
+        fprintf(out, "\tsim %s: OVERFLOW, hyperperiod does not fit 64 bits\n", report_policy_name(policy));
+        return;
+    }
+
+    fprintf(out, "\tsim %s: %s over [0, %llu) jobs=%llu preemptions=%llu misses=%llu",
+            report_policy_name(policy), (verdict == TRUE) ? "FEASIBLE" : "INFEASIBLE",
+            result->horizon, result->jobs, result->preemptions, result->misses);
+    if(result->misses > 0)
+        fprintf(out, " first miss S%u at %llu", result->firstMissTask, result->firstMiss);
+    if(result->overloaded)
+        fprintf(out, " overloaded U > 1");
+    if(verdict != analytic)
+        fprintf(out, " MISMATCH with analysis");
+    fprintf(out, "\n\tschedule:");
+
+    for(k = 0; k < result->count; k++)
+    {
+        if(result->timeline[k].task == SIM_IDLE)
+            fprintf(out, " %llu-%llu idle", result->timeline[k].start,
+                    result->timeline[k].start + result->timeline[k].length);
+        else
+            fprintf(out, " %llu-%llu S%u", result->timeline[k].start,
+                    result->timeline[k].start + result->timeline[k].length, result->timeline[k].task);
+    }
+    fprintf(out, "%s\n", result->truncated ? " ..." : "");
+}
+
+void report_partition(FILE *out, U32_T numServices, const U32_T core_of[], int placed,
+                      U32_T numCores) {
+    U32_T i;
+
+    fprintf(out, "\tpartition onto %u cores: %s, %d/%u placed, map:", numCores,
+            (placed == (int)numServices) ? "FEASIBLE" : "INFEASIBLE", placed, numServices);
+
+    for(i = 0; i < numServices; i++)
+    {
+        if(core_of[i] == PART_NONE)
+            fprintf(out, " S%u=-", i);
+        else
+            fprintf(out, " S%u=%u", i, core_of[i]);
+    }
+    fprintf(out, "\n");
+}
+
+// one log2 histogram, bucket b > 0 covers [2^(b-1), 2^b)
+static void report_hist(FILE *out, const char *test, const char *kind, const U64_T hist[]) {
+    U64_T lo, hi;
+    U32_T b;
+
+    for(b = 0; b < FEAS_HIST_BUCKETS; b++)
+    {
+        if(hist[b] == 0)
+            continue;
+        lo = (b == 0) ? 0 : 1ull << (b - 1);
+        hi = (b == 0) ? 1 : 1ull << b;
+        fprintf(out, "\t%s %s [%llu, %llu): %llu\n", test, kind, lo, hi, hist[b]);
+    }
+}
+
+void report_stats(FILE *out, const feas_stats_t *stats) {
+    static const char *tests[FEAS_TEST_COUNT] = { "completion", "sched_point", "edf" };
+    static const char *works[FEAS_TEST_COUNT] = { "passes", "points", "qpa_steps" };
+    static const char *exits[FEAS_EXIT_COUNT] = { "feasible", "miss", "pruned", "util",
+                                                  "shortcut", "overflow" };
+    const feas_test_stats_t *test;
+    U32_T t, k;
+
+    for(t = 0; t < FEAS_TEST_COUNT; t++)
+    {
+        test = &stats->test[t];
+        fprintf(out, "%s: %llu calls, %llu cycles (%.1f per call), %llu %s", tests[t], test->calls,
+                test->cycles, (test->calls > 0) ? (double)test->cycles / (double)test->calls : 0.0,
+                test->work, works[t]);
+        for(k = 0; k < FEAS_EXIT_COUNT; k++)
+            if(test->exits[k] != 0)
+                fprintf(out, ", %s %llu", exits[k], test->exits[k]);
+        fprintf(out, "\n");
+
+        report_hist(out, tests[t], "cycles", test->cycleHist);
+        report_hist(out, tests[t], works[t], test->workHist);
+    }
+
+    fprintf(out, "64 bit sets: %llu, point set fallbacks: %llu\n", stats->events[FEAS_EVENT_WIDE],
+            stats->events[FEAS_EVENT_FALLBACK]);
+}
+
+void report_stages(FILE *out, const U64_T counts[BATCH_STAGE_COUNT]) {
+    // in cascade order, the memo is consulted between the screen and the exact tests
+    static const int order[BATCH_STAGE_COUNT] = { BATCH_STAGE_UTIL, BATCH_STAGE_LUB,
+                                                  BATCH_STAGE_HB, BATCH_STAGE_MEMO,
+                                                  BATCH_STAGE_RTA, BATCH_STAGE_SP };
+    static const char *names[BATCH_STAGE_COUNT] = { "U>1", "lub", "hyperbolic", "rta", "sched_point",
+                                                    "memo" };
+    U64_T total = 0, reaching;
+    U32_T k;
+
+    for(k = 0; k < BATCH_STAGE_COUNT; k++)
+        total += counts[k];
+
+    fprintf(out, "stages: %llu sets\n", total);
+
+    for(reaching = total, k = 0; k < BATCH_STAGE_COUNT; k++)
+    {
+        fprintf(out, "\t%s: %llu of %llu reaching it settled (%.1f%%), %.1f%% of all sets\n",
+                names[order[k]], counts[order[k]], reaching,
+                (reaching > 0) ? 100.0 * (double)counts[order[k]] / (double)reaching : 0.0,
+                (total > 0) ? 100.0 * (double)counts[order[k]] / (double)total : 0.0);
+        reaching -= counts[order[k]];
+    }
+}
+
+void report_sensitivity(FILE *out, U32_T numServices, const U32_T maxWcet[], const U32_T minPeriod[],
+                        double scale) {
+    U32_T i;
+
+    if(isinf(scale))
+        fprintf(out, "\tsensitivity: scale unbounded,");
+    else
+        fprintf(out, "\tsensitivity: scale %.6f,", scale);
+
+    for(i = 0; i < numServices; i++)
+    {
+        fprintf(out, " S%u:", i);
+        if(maxWcet[i] == SENS_NONE)
+            fprintf(out, "C<=-");
+        else
+            fprintf(out, "C<=%u", maxWcet[i]);
+        if(minPeriod[i] == SENS_NONE)
+            fprintf(out, ",T>=-");
+        else
+            fprintf(out, ",T>=%u", minPeriod[i]);
+    }
+    fprintf(out, "\n");
+}
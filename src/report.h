@@ -0,0 +1,92 @@
+/**
+ *  @name   report
+ *  @brief  optional human readable reporting on top of the silent feasibility kernels
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <stdio.h>
+
+#include "batch.h"
+#include "feasibility.h"
+#include "instrument.h"
+#include "partition.h"
+#include "sensitivity.h"
+#include "sim.h"
+#include "sweep.h"
+
+/**
+ *  @brief  rate_monotonic_least_upper_bound with the per-service utilization trace written to out
+*/
+int report_rm_lub(FILE *out, U32_T numServices, const U32_T period[], const U32_T wcet[],
+                  const U32_T deadline[]);
+
+/**
+ *  @brief  run every test on one T=D set and print the verdicts to stdout
+*/
+void print_test_results(U32_T numServices, U32_T period[], U32_T wcet[]);
+
+/**
+ *  @brief  one line per set of a batch, sets numbered from firstId
+*/
+void report_batch(FILE *out, const taskset_batch_t *batch, const feasibility_result_t results[],
+                  U32_T firstId);
+
+/**
+ *  @brief  simulation verdict and run-length timeline of one set
+ *
+ *  @param  analytic    verdict of the matching exact test, a disagreement is flagged
+*/
+void report_schedule(FILE *out, int policy, int verdict, const sim_result_t *result, int analytic);
+
+/**
+ *  @brief  verdict and core affinity map of one partitioned set, S<i>=- for unplaced services
+ *
+ *  @param  placed  partition_assign return value
+*/
+void report_partition(FILE *out, U32_T numServices, const U32_T core_of[], int placed,
+                      U32_T numCores);
+
+/**
+ *  @brief  sensitivity of one set, the critical scaling factor then the largest C and smallest T of
+ *          every service with the others as given, - where no value works
+*/
+void report_sensitivity(FILE *out, U32_T numServices, const U32_T maxWcet[], const U32_T minPeriod[],
+                        double scale);
+
+/**
+ *  @brief  per test call counts, exit reasons, cycles and log2 histograms of cycles and work
+ *
+ *  Histogram rows are tab indented "<test> <cycles|work> [lo, hi): count" lines, empty
+ *  buckets are skipped.
+*/
+void report_stats(FILE *out, const feas_stats_t *stats);
+
+/**
+ *  @brief  sets settled by each BATCH_STAGE_*, with the share of the sets that reached the stage
+*/
+void report_stages(FILE *out, const U64_T counts[BATCH_STAGE_COUNT]);
+
+/**
+ *  @brief  column header of report_sweep_cell rows, # prefixed for plotting tools
+ *
+ *  @param  multicore   also name the GFB, BCL, global FP and partitioned columns
+*/
+void report_sweep_header(FILE *out, int multicore);
+
+/**
+ *  @brief  one row of acceptance ratios: n, target U, sets, mean and standard deviation of the
+ *          generated U, then the share of the sets each test accepted
+*/
+void report_sweep_cell(FILE *out, const sweep_cell_t *cell, int multicore);
+
+/**
+ *  @brief  name of a SIM_* policy as used on the command line
+*/
+const char *report_policy_name(int policy);
+
+#endif
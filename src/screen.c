@@ -0,0 +1,169 @@
+/**
+ *  @name   screen
+ *  @brief  vectorized utilization and RM LUB / hyperbolic bound screening for batches of task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCREEN_HAVE_AVX2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define SCREEN_HAVE_NEON
+#endif
+
+#include "exact.h"
+#include "screen.h"
+
+// tasks per vector pass, sized so the scratch row stays in L1
+#define SCREEN_BLOCK    512
+
+static void utilization_scalar(const U32_T wcet[], const U32_T period[], U32_T len, double u[]) {
+    U32_T k;
+
+    for(k = 0; k < len; k++)
+        u[k] = (double)wcet[k] / (double)period[k];
+}
+
+#if defined(SCREEN_HAVE_AVX2)
+// _mm256_cvtepi32_pd is signed, bias by 2^31 so periods above INT_MAX convert correctly
+static inline __m256d __attribute__((target("avx2"))) cvt_u32_pd(__m128i v) {
+    const __m128i  flip = _mm_set1_epi32((int)0x80000000u);
+    const __m256d  bias = _mm256_set1_pd(2147483648.0);
+
+    return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(v, flip)), bias);
+}
+
+static void __attribute__((target("avx2")))
+utilization_avx2(const U32_T wcet[], const U32_T period[], U32_T len, double u[]) {
+    U32_T k;
+
+    for(k = 0; k + 4 <= len; k += 4)
+    {
+        __m256d c = cvt_u32_pd(_mm_loadu_si128((const __m128i *)(wcet + k)));
+        __m256d t = cvt_u32_pd(_mm_loadu_si128((const __m128i *)(period + k)));
+
+        _mm256_storeu_pd(u + k, _mm256_div_pd(c, t));
+    }
+
+    utilization_scalar(wcet + k, period + k, len - k, u + k);
+}
+#endif
+
+#if defined(SCREEN_HAVE_NEON)
+static void utilization_neon(const U32_T wcet[], const U32_T period[], U32_T len, double u[]) {
+    U32_T k;
+
+    for(k = 0; k + 2 <= len; k += 2)
+    {
+        float64x2_t c = vcvtq_f64_u64(vmovl_u32(vld1_u32(wcet + k)));
+        float64x2_t t = vcvtq_f64_u64(vmovl_u32(vld1_u32(period + k)));
+
+        vst1q_f64(u + k, vdivq_f64(c, t));
+    }
+
+    utilization_scalar(wcet + k, period + k, len - k, u + k);
+}
+#endif
+
+static void utilization_block(const U32_T wcet[], const U32_T period[], U32_T len, double u[]) {
+#if defined(SCREEN_HAVE_AVX2)
+    if(__builtin_cpu_supports("avx2"))
+    {
+        utilization_avx2(wcet, period, len, u);
+        return;
+    }
+#elif defined(SCREEN_HAVE_NEON)
+    utilization_neon(wcet, period, len, u);
+    return;
+#endif
+    utilization_scalar(wcet, period, len, u);
+}
+
+// bands of the double values around 1, the LUB and 2 are settled exactly, see exact.h
+static void screen_finish(feasibility_result_t *res, U32_T n, const U32_T period[], const U32_T wcet[],
+                          double util, double hyper, int d_ge_t) {
+    int lub = exact_lub_compare_from(n, period, wcet, util);
+
+    res->utilization = util;
+    res->lub         = rm_lub_bound(n);
+    res->hyperbolic  = hyper;
+    res->rm_lub      = (lub <= 0) ? TRUE : FALSE;
+
+    // the stage of an undecided set is settled by the exact tests
+    res->stage = BATCH_STAGE_RTA;
+
+    // U > 1 overloads one core whatever the deadlines are
+    if(exact_util_compare_from(n, period, wcet, util) > 0)
+    {
+        res->screen = SCREEN_INFEASIBLE;
+        res->stage  = BATCH_STAGE_UTIL;
+    }
+    else if(d_ge_t && lub <= 0)
+    {
+        res->screen = SCREEN_FEASIBLE;
+        res->stage  = BATCH_STAGE_LUB;
+    }
+    else if(d_ge_t && exact_hyperbolic_compare_from(n, period, wcet, hyper) <= 0)
+    {
+        res->screen = SCREEN_FEASIBLE;
+        res->stage  = BATCH_STAGE_HB;
+    }
+    else
+        res->screen = SCREEN_UNKNOWN;
+}
+
+void screen_batch_range(const taskset_batch_t *batch, U32_T first, U32_T last,
+                        feasibility_result_t results[]) {
+    double u[SCREEN_BLOCK];
+    double util = 0.0, hyper = 1.0;
+    int d_ge_t = TRUE;
+    U32_T s, blk, len, k, t, end;
+
+    if(first >= last)
+        return;
+
+    s   = first;
+    end = batch->offset[last];
+
+    for(blk = batch->offset[first]; blk < end; blk += len)
+    {
+        len = end - blk;
+        if(len > SCREEN_BLOCK)
+            len = SCREEN_BLOCK;
+
+        utilization_block(batch->wcet + blk, batch->period + blk, len, u);
+
+        // segmented reduction, sets may straddle blocks so the partial sums carry over
+        for(k = 0; k < len; k++)
+        {
+            t = blk + k;
+
+            while(t >= batch->offset[s + 1])
+            {
+                screen_finish(&results[s], batch->offset[s + 1] - batch->offset[s],
+                              batch->period + batch->offset[s], batch->wcet + batch->offset[s],
+                              util, hyper, d_ge_t);
+                s++;
+                util = 0.0; hyper = 1.0;
+                d_ge_t = TRUE;
+            }
+
+            util  += u[k];
+            hyper *= u[k] + 1.0;
+            d_ge_t &= batch->deadline[t] >= batch->period[t];
+        }
+    }
+
+    // last set with tasks plus any trailing empty sets
+    for(; s < last; s++)
+    {
+        screen_finish(&results[s], batch->offset[s + 1] - batch->offset[s],
+                      batch->period + batch->offset[s], batch->wcet + batch->offset[s],
+                      util, hyper, d_ge_t);
+        util = 0.0; hyper = 1.0;
+        d_ge_t = TRUE;
+    }
+}
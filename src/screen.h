@@ -0,0 +1,34 @@
+/**
+ *  @name   screen
+ *  @brief  vectorized utilization and RM LUB / hyperbolic bound screening for batches of task sets
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Bini, Enrico, Giorgio C. Buttazzo, and Giuseppe M. Buttazzo. "Rate monotonic analysis: the hyperbolic bound."
+ *          IEEE Transactions on Computers 52.7 (2003): 933-942.
+*/
+
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include "batch.h"
+
+#define SCREEN_UNKNOWN      0
+#define SCREEN_FEASIBLE     1
+#define SCREEN_INFEASIBLE   2
+
+/**
+ *  @brief  fill utilization, lub, hyperbolic, screen and stage for sets [first, last) of the batch
+ *
+ *  The C(i)/T(i) divisions run 4 wide with AVX2 (or 2 wide with NEON) over the packed
+ *  columns, so many small sets share one vector pass. The verdict is decisive only when it
+ *  agrees with the exact tests on the same set:
+ *      SCREEN_FEASIBLE     D >= T for every service and U <= LUB or prod(U(i) + 1) <= 2
+ *      SCREEN_INFEASIBLE   U > 1, whatever the deadlines
+ *      SCREEN_UNKNOWN      anything else, the exact tests have to run
+*/
+void screen_batch_range(const taskset_batch_t *batch, U32_T first, U32_T last,
+                        feasibility_result_t results[]);
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ *  @name   sensitivity
+ *  @brief  WCET and period sensitivity of a fixed priority task set under the completion test
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "sensitivity.h"
+
+// bisection stops once the scale interval is this narrow relative to its upper end
+#define SENS_SCALE_PRECISION    1e-9
+
+// relative slack on the U <= 1 caps, far above the long double rounding so a cap never
+// rules out a value the completion test would accept
+#define SENS_UTIL_SLACK         1e-12L
+
+/**
+ *  Completion test of services [from, n) with the fixed points of [0, from) already in
+ *  resp[]. Each service starts from the larger of R(prev) + C(i) and lower[i] when lower is
+ *  given. On TRUE resp[from..n) holds the new fixed points.
+*/
+static int probe(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                 const U32_T deadline[], U32_T from, const U32_T lower[], U32_T resp[]) {
+    U32_T i, an = 0, start;
+
+    // R(k) + C(i) needs the last service above with work
+    for(i = from; i-- > 0; )
+    {
+        if(wcet[i] != 0)
+        {
+            an = resp[i];
+            break;
+        }
+    }
+
+    for(i = from; i < numServices; i++)
+    {
+        // a warm start is only a lower bound while it was a first job's response time
+        start = an + wcet[i];
+        if(lower != NULL && lower[i] > start && lower[i] <= period[i])
+            start = lower[i];
+
+        resp[i] = response_time_service(i, period, wcet, deadline, start);
+        if(resp[i] > deadline[i])
+            return FALSE;
+
+        if(wcet[i] != 0)
+            an = resp[i];
+    }
+
+    return TRUE;
+}
+
+// U of every service but k
+static long double others_utilization(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                      U32_T k) {
+    long double u = 0.0L;
+    U32_T i;
+
+    for(i = 0; i < numServices; i++)
+        if(i != k)
+            u += (long double)wcet[i] / (long double)period[i];
+
+    return u;
+}
+
+// fixed points of the services above k, which no search on k can move
+static int probe_prefix(U32_T k, const U32_T period[], const U32_T wcet[],
+                        const U32_T deadline[], U32_T resp[]) {
+    return probe(k, period, wcet, deadline, 0, NULL, resp);
+}
+
+U32_T sensitivity_max_wcet(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[], U32_T k, U32_T scratch[]) {
+    U32_T *trial = scratch, *lower = scratch + numServices, *resp = scratch + 2 * numServices;
+    U64_T lo, hi, mid, cap;
+    long double room;
+
+    if(!probe_prefix(k, period, wcet, deadline, resp))
+        return SENS_NONE;
+
+    memcpy(trial, wcet, sizeof(U32_T) * numServices);
+
+    // lo is the largest C known to pass, hi the smallest known to fail
+    trial[k] = 0;
+    if(!probe(numServices, period, trial, deadline, k, NULL, resp))
+        return SENS_NONE;
+    memcpy(lower, resp, sizeof(U32_T) * numServices);
+
+    lo = 0;
+    hi = (U64_T)deadline[k] + 1;
+
+    // one core runs at most all of its time, C(k) <= T(k) (1 - U of the others)
+    room = (long double)period[k] * (1.0L - others_utilization(numServices, period, wcet, k));
+    if(room < (long double)hi)
+    {
+        cap = (room > 0.0L) ? (U64_T)floorl(room * (1.0L + SENS_UTIL_SLACK)) + 1 : 1;
+        if(cap < hi)
+            hi = cap;
+    }
+
+    // the C as given first, a feasible set then only searches above it
+    mid = (wcet[k] > lo && wcet[k] < hi) ? wcet[k] : lo + (hi - lo) / 2;
+    while(hi - lo > 1)
+    {
+        trial[k] = (U32_T)mid;
+        if(probe(numServices, period, trial, deadline, k, lower, resp))
+        {
+            lo = mid;
+            memcpy(lower + k, resp + k, sizeof(U32_T) * (numServices - k));
+        }
+        else
+            hi = mid;
+
+        mid = lo + (hi - lo) / 2;
+    }
+
+    return (U32_T)lo;
+}
+
+U32_T sensitivity_min_period(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                             const U32_T deadline[], U32_T k, U32_T scratch[]) {
+    U32_T *trial = scratch, *lower = scratch + numServices, *resp = scratch + 2 * numServices;
+    U32_T *trialDeadline = scratch + 3 * numServices;
+    U32_T lo, hi, mid, i;
+    long double others, least;
+
+    if(!probe_prefix(k, period, wcet, deadline, resp))
+        return SENS_NONE;
+
+    memcpy(trial, period, sizeof(U32_T) * numServices);
+    memcpy(trialDeadline, deadline, sizeof(U32_T) * numServices);
+
+    // past every deadline below, one job of k is all the interference it can ever add
+    hi = period[k];
+    for(i = k; i < numServices; i++)
+        if(deadline[i] > hi)
+            hi = deadline[i];
+
+    trial[k] = hi;
+    trialDeadline[k] = (deadline[k] == period[k]) ? hi : deadline[k];
+    if(!probe(numServices, trial, wcet, trialDeadline, k, NULL, resp))
+        return SENS_NONE;
+    memcpy(lower, resp, sizeof(U32_T) * numServices);
+
+    // lo is the largest T known to fail, a zero period never works, and neither does one
+    // below C(k) / (1 - U of the others), which puts U past 1
+    lo = 0;
+    others = others_utilization(numServices, period, wcet, k);
+    if(wcet[k] != 0 && others < 1.0L)
+    {
+        least = floorl((long double)wcet[k] / (1.0L - others) * (1.0L - SENS_UTIL_SLACK));
+        if(least > 0.0L && least < (long double)hi)
+            lo = (U32_T)least;
+    }
+    mid = (period[k] > lo && period[k] < hi) ? period[k] : lo + (hi - lo) / 2;
+    while(hi - lo > 1)
+    {
+        trial[k] = mid;
+        if(deadline[k] == period[k])
+            trialDeadline[k] = mid;
+        else if(deadline[k] < period[k])
+            trialDeadline[k] = (deadline[k] < mid) ? deadline[k] : mid;
+
+        // a shorter period only adds interference, so the last pass is a lower bound
+        if(probe(numServices, trial, wcet, trialDeadline, k, lower, resp))
+        {
+            hi = mid;
+            memcpy(lower + k, resp + k, sizeof(U32_T) * (numServices - k));
+        }
+        else
+            lo = mid;
+
+        mid = lo + (hi - lo) / 2;
+    }
+
+    return hi;
+}
+
+// ceil(a * C(i)) for every service, false once some C passes its deadline
+static int scale_wcet(U32_T numServices, const U32_T wcet[], const U32_T deadline[], double a,
+                      U32_T trial[]) {
+    U32_T i;
+    double c;
+
+    for(i = 0; i < numServices; i++)
+    {
+        c = ceil(a * (double)wcet[i]);
+        if(c > (double)deadline[i])
+            return FALSE;
+        trial[i] = (U32_T)c;
+    }
+
+    return TRUE;
+}
+
+double sensitivity_wcet_scale(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                              const U32_T deadline[], U32_T scratch[]) {
+    U32_T *trial = scratch, *lower = scratch + numServices, *resp = scratch + 2 * numServices;
+    double lo = 0.0, hi = 0.0, mid, bound;
+    U32_T i;
+    int warm = FALSE;
+
+    // no scaling can push a C past its own deadline, so the answer is below min D/C
+    for(i = 0; i < numServices; i++)
+    {
+        if(wcet[i] == 0)
+            continue;
+        bound = (double)deadline[i] / (double)wcet[i];
+        if(hi == 0.0 || bound < hi)
+            hi = bound;
+    }
+
+    // nothing to scale
+    if(hi == 0.0)
+        return HUGE_VAL;
+
+    if(scale_wcet(numServices, wcet, deadline, hi, trial) &&
+       probe(numServices, period, trial, deadline, 0, NULL, resp))
+        return hi;
+
+    // any small enough scale rounds every nonzero C up to 1, if that fails nothing works
+    for(i = 0; i < numServices; i++)
+        trial[i] = (wcet[i] != 0) ? 1 : 0;
+    if(!probe(numServices, period, trial, deadline, 0, NULL, resp))
+        return 0.0;
+
+    mid = (hi > 1.0) ? 1.0 : hi / 2.0;
+    while(hi - lo > SENS_SCALE_PRECISION * hi && mid > lo && mid < hi)
+    {
+        // a larger scale only grows every C, so the last feasible pass is a lower bound
+        if(scale_wcet(numServices, wcet, deadline, mid, trial) &&
+           probe(numServices, period, trial, deadline, 0, warm ? lower : NULL, resp))
+        {
+            lo = mid;
+            memcpy(lower, resp, sizeof(U32_T) * numServices);
+            warm = TRUE;
+        }
+        else
+            hi = mid;
+
+        mid = lo + (hi - lo) / 2.0;
+    }
+
+    return lo;
+}
@@ -0,0 +1,62 @@
+/**
+ *  @name   sensitivity
+ *  @brief  WCET and period sensitivity of a fixed priority task set under the completion test
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Lehoczky, John, Lui Sha, and Yuqin Ding. "The rate monotonic scheduling algorithm: Exact
+ *          characterization and average case behavior." RTSS. Vol. 89. 1989. (critical scaling factor)
+*/
+
+#ifndef SENSITIVITY_H
+#define SENSITIVITY_H
+
+#include "feasibility.h"
+
+// no value of the searched parameter makes the set feasible
+#define SENS_NONE   0xFFFFFFFFu
+
+/**
+ *  All searches bisect over a parameter the completion test is monotone in and keep the
+ *  priority order of the arrays as given. Services above the one being varied are analyzed
+ *  once, and every probe warm starts the rest from the response times of the last feasible
+ *  probe, which stay lower bounds for every probe the bisection can still make. D > T
+ *  services are probed with the busy window of response_time_service, and no search goes
+ *  past U = 1.
+ *
+ *  scratch is 4 * numServices entries for every call.
+*/
+
+/**
+ *  @brief  largest C(k) in [0, D(k)], and at most T(k) (1 - U of the others), that keeps
+ *          the set feasible, the others unchanged
+ *
+ *  @return the WCET, or SENS_NONE if the set misses even with C(k) = 0
+*/
+U32_T sensitivity_max_wcet(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                           const U32_T deadline[], U32_T k, U32_T scratch[]);
+
+/**
+ *  @brief  smallest T(k) that keeps the set feasible, the others unchanged
+ *
+ *  An implicit deadline (D(k) = T(k)) shrinks with the period, a constrained one is kept
+ *  and clipped to the period and one past the period is left as it is.
+ *
+ *  @return the period, at least C(k) / (1 - U of the others), or SENS_NONE if no period up to
+ *          max(T(k), D(k..n-1)) works
+*/
+U32_T sensitivity_min_period(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                             const U32_T deadline[], U32_T k, U32_T scratch[]);
+
+/**
+ *  @brief  critical scaling factor, the largest a with every C(i) raised to ceil(a * C(i))
+ *          still feasible, to within a relative 1e-9
+ *
+ *  @return a, 1 or more when the set as given is feasible, 0 if even C = 1 for every nonzero
+ *          C misses, HUGE_VAL if every C is 0
+*/
+double sensitivity_wcet_scale(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                              const U32_T deadline[], U32_T scratch[]);
+
+#endif
@@ -0,0 +1,426 @@
+/**
+ *  @name   server
+ *  @brief  admission control daemon answering fixed size binary requests on a Unix domain socket
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "server.h"
+
+typedef struct {
+    int             fd;
+    int             closing;    // hung up, dropped once its last batch is answered
+    size_t          inLen;
+    size_t          outLen;
+    size_t          outOff;
+    unsigned char   in[SERVER_CLIENT_BATCH * sizeof(server_request_t)];
+    unsigned char   out[SERVER_CLIENT_BATCH * sizeof(server_reply_t)];
+} server_client_t;
+
+typedef struct {
+    U32_T               client;
+    server_request_t    request;
+    server_reply_t      reply;
+} server_item_t;
+
+static volatile sig_atomic_t stopping;
+
+static void server_stop(int sig) {
+    (void)sig;
+    stopping = 1;
+}
+
+static int set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+
+    return (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) ? -1 : 0;
+}
+
+static int server_address(struct sockaddr_un *addr, const char *path) {
+    if(strlen(path) >= sizeof(addr->sun_path))
+        return -1;
+
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+    return 0;
+}
+
+// reply value of an admitted service, its exact R
+static void reply_response(admission_ctx_t *ctx, server_item_t *item, U32_T id) {
+    item->reply.id    = id;
+    item->reply.value = 0;
+    admission_response(ctx, id, &item->reply.value);
+}
+
+static int add_valid(const server_request_t *r) {
+    return r->arg[0] > 0 && r->arg[2] > 0 && r->arg[1] <= r->arg[2];
+}
+
+// the requests between two CLEARs, removes first, then the adds placed together
+static void server_segment(admission_ctx_t *ctx, server_item_t items[], U32_T count, server_stats_t *stats) {
+    server_request_t *r;
+    server_item_t *item;
+    U32_T k, adds = 0, capacity;
+    double addU = 0.0;
+    int fits;
+
+    for(k = 0; k < count; k++)
+    {
+        item = &items[k];
+        r    = &item->request;
+        item->reply.op     = r->op;
+        item->reply.status = TRUE;
+        item->reply.id     = 0;
+        item->reply.value  = 0;
+
+        if(r->op == SERVER_REMOVE)
+        {
+            item->reply.id     = r->arg[0];
+            item->reply.status = admission_remove(ctx, r->arg[0]);
+        }
+        else if(r->op == SERVER_ADD && add_valid(r))
+        {
+            adds++;
+            addU += (double)r->arg[1] / (double)r->arg[0];
+        }
+        else if(r->op == SERVER_ADD || (r->op != SERVER_QUERY && r->op != SERVER_STATUS))
+            item->reply.status = SERVER_EBADREQ;
+    }
+
+    // doubling keeps the regrowth rare, the adds all get a slot or all fall back to FALSE
+    capacity = ctx->capacity;
+    while(capacity < ctx->count + adds)
+        capacity = (capacity > 0) ? capacity * 2 : 64;
+    fits = (admission_reserve(ctx, capacity) == 0);
+
+    if(adds > 0 && fits)
+    {
+        // a lone add is best served by admission_add and its early rejects, and a set over
+        // U = 1 cannot pass, both go straight to the one at a time path
+        if(adds > 1 && ctx->utilization + addU <= 1.0)
+        {
+            for(k = 0; k < count; k++)
+                if(items[k].request.op == SERVER_ADD && items[k].reply.status == TRUE)
+                    admission_place(ctx, items[k].request.arg[0], items[k].request.arg[1],
+                                    items[k].request.arg[2], &items[k].reply.id);
+            if(admission_refresh(ctx) == TRUE)
+                adds = 0;
+            else
+            {
+                for(k = 0; k < count; k++)
+                    if(items[k].request.op == SERVER_ADD && items[k].reply.status == TRUE)
+                        admission_remove(ctx, items[k].reply.id);
+            }
+        }
+
+        if(adds > 0)
+        {
+            stats->fallbacks += (adds > 1);
+            for(k = 0; k < count; k++)
+                if(items[k].request.op == SERVER_ADD && items[k].reply.status == TRUE)
+                    items[k].reply.status = admission_add(ctx, items[k].request.arg[0],
+                                                          items[k].request.arg[1],
+                                                          items[k].request.arg[2], &items[k].reply.id);
+        }
+    }
+
+    for(k = 0; k < count; k++)
+    {
+        item = &items[k];
+        r    = &item->request;
+
+        if(r->op == SERVER_ADD && item->reply.status == TRUE)
+        {
+            if(!fits)
+                item->reply.status = FALSE;
+            else
+                reply_response(ctx, item, item->reply.id);
+        }
+        else if(r->op == SERVER_QUERY)
+        {
+            item->reply.id     = r->arg[0];
+            item->reply.status = admission_response(ctx, r->arg[0], &item->reply.value);
+        }
+        else if(r->op == SERVER_STATUS)
+        {
+            item->reply.id    = ctx->count;
+            item->reply.value = (U32_T)(ctx->utilization * 1e6 + 0.5);
+        }
+    }
+}
+
+// a CLEAR splits the batch, whatever came before it is applied and answered first
+static void server_batch(admission_ctx_t *ctx, server_item_t items[], U32_T count, server_stats_t *stats) {
+    U32_T k, first = 0;
+
+    for(k = 0; k <= count; k++)
+    {
+        if(k < count && items[k].request.op != SERVER_CLEAR)
+            continue;
+
+        if(k > first)
+            server_segment(ctx, items + first, k - first, stats);
+
+        if(k < count)
+        {
+            items[k].reply.op     = SERVER_CLEAR;
+            items[k].reply.status = TRUE;
+            items[k].reply.id     = 0;
+            items[k].reply.value  = ctx->count;
+            admission_clear(ctx);
+        }
+        first = k + 1;
+    }
+
+    stats->batches++;
+    stats->requests += count;
+}
+
+// whatever of the pending replies the socket takes now, the rest on the next POLLOUT
+static void client_flush(server_client_t *c) {
+    ssize_t sent;
+
+    while(c->outOff < c->outLen)
+    {
+        sent = send(c->fd, c->out + c->outOff, c->outLen - c->outOff, MSG_NOSIGNAL);
+        if(sent < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            if(errno != EAGAIN && errno != EWOULDBLOCK)
+                c->closing = TRUE;
+            return;
+        }
+        c->outOff += (size_t)sent;
+    }
+
+    c->outLen = 0;
+    c->outOff = 0;
+}
+
+// fill the input buffer and move its whole requests into the batch
+static U32_T client_read(server_client_t *c, U32_T index, server_item_t items[]) {
+    size_t whole, k;
+    ssize_t got;
+    U32_T count = 0;
+
+    while(c->inLen < sizeof(c->in))
+    {
+        got = recv(c->fd, c->in + c->inLen, sizeof(c->in) - c->inLen, 0);
+        if(got > 0)
+            c->inLen += (size_t)got;
+        else if(got == 0 || (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK))
+        {
+            c->closing = TRUE;
+            break;
+        }
+        else if(errno != EINTR)
+            break;
+    }
+
+    whole = c->inLen / sizeof(server_request_t);
+    for(k = 0; k < whole; k++, count++)
+    {
+        items[count].client = index;
+        memcpy(&items[count].request, c->in + k * sizeof(server_request_t), sizeof(server_request_t));
+    }
+
+    c->inLen -= whole * sizeof(server_request_t);
+    memmove(c->in, c->in + whole * sizeof(server_request_t), c->inLen);
+    return count;
+}
+
+int server_run(const char *path, U32_T capacity, server_stats_t *stats, char error[128]) {
+    struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+    server_client_t *clients;
+    server_item_t *items;
+    struct sockaddr_un addr;
+    struct sigaction sa;
+    admission_ctx_t ctx;
+    U32_T numClients = 0, count, k, j;
+    int listener, fd, rc = 0;
+
+    memset(stats, 0, sizeof(*stats));
+    if(server_address(&addr, path) != 0)
+    {
+        snprintf(error, 128, "socket path longer than %zu characters", sizeof(addr.sun_path) - 1);
+        return -1;
+    }
+
+    clients = malloc(sizeof(server_client_t) * SERVER_MAX_CLIENTS);
+    items   = malloc(sizeof(server_item_t) * SERVER_MAX_CLIENTS * SERVER_CLIENT_BATCH);
+    if(clients == NULL || items == NULL || admission_init(&ctx, (capacity > 0) ? capacity : 64) != 0)
+    {
+        snprintf(error, 128, "no memory for the server state");
+        free(clients);
+        free(items);
+        return -1;
+    }
+
+    if((listener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 || set_nonblocking(listener) != 0 ||
+       (unlink(path) != 0 && errno != ENOENT) ||
+       bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+       listen(listener, SERVER_MAX_CLIENTS) != 0)
+    {
+        snprintf(error, 128, "%s: %s", path, strerror(errno));
+        if(listener >= 0)
+            close(listener);
+        admission_destroy(&ctx);
+        free(clients);
+        free(items);
+        return -1;
+    }
+
+    // no SA_RESTART, a signal has to break the poll
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = server_stop;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    stopping = 0;
+
+    while(!stopping)
+    {
+        fds[0].fd     = listener;
+        fds[0].events = (numClients < SERVER_MAX_CLIENTS) ? POLLIN : 0;
+        for(k = 0; k < numClients; k++)
+        {
+            fds[k + 1].fd = clients[k].fd;
+            // a client with replies still queued is not read until they are out
+            fds[k + 1].events = (clients[k].outLen > 0) ? POLLOUT : POLLIN;
+        }
+
+        if(poll(fds, numClients + 1, -1) < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            snprintf(error, 128, "poll: %s", strerror(errno));
+            rc = -1;
+            break;
+        }
+
+        count = 0;
+        for(k = 0; k < numClients; k++)
+        {
+            // the out buffer only has room for a batch on top of nothing, a hang up with
+            // replies pending ends in the flush failing
+            if(clients[k].outLen > 0)
+            {
+                if(fds[k + 1].revents & (POLLOUT | POLLHUP | POLLERR))
+                    client_flush(&clients[k]);
+            }
+            else if(fds[k + 1].revents & (POLLIN | POLLHUP | POLLERR))
+                count += client_read(&clients[k], k, items + count);
+        }
+
+        if(count > 0)
+        {
+            server_batch(&ctx, items, count, stats);
+
+            // the items are in client order, so each client's replies stay in its request order
+            for(k = 0; k < count; k++)
+            {
+                server_client_t *c = &clients[items[k].client];
+                memcpy(c->out + c->outLen, &items[k].reply, sizeof(server_reply_t));
+                c->outLen += sizeof(server_reply_t);
+            }
+            for(k = 0; k < numClients; k++)
+                if(clients[k].outLen > 0)
+                    client_flush(&clients[k]);
+        }
+
+        for(k = 0, j = 0; k < numClients; k++)
+        {
+            if(clients[k].closing)
+                close(clients[k].fd);
+            else
+                clients[j++] = clients[k];
+        }
+        numClients = j;
+
+        if(fds[0].revents & POLLIN)
+        {
+            while(numClients < SERVER_MAX_CLIENTS && (fd = accept(listener, NULL, NULL)) >= 0)
+            {
+                if(set_nonblocking(fd) != 0)
+                {
+                    close(fd);
+                    continue;
+                }
+                memset(&clients[numClients], 0, offsetof(server_client_t, in));
+                clients[numClients++].fd = fd;
+            }
+        }
+    }
+
+    for(k = 0; k < numClients; k++)
+        close(clients[k].fd);
+    close(listener);
+    unlink(path);
+    admission_destroy(&ctx);
+    free(clients);
+    free(items);
+    return rc;
+}
+
+int server_connect(const char *path) {
+    struct sockaddr_un addr;
+    int fd;
+
+    if(server_address(&addr, path) != 0)
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    if((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        return -1;
+
+    if(connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// all of len bytes or -1, for the blocking client side
+static int transfer(int fd, void *buf, size_t len, int out) {
+    unsigned char *p = buf;
+    ssize_t n;
+
+    while(len > 0)
+    {
+        n = out ? send(fd, p, len, MSG_NOSIGNAL) : recv(fd, p, len, 0);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return -1;
+        p   += n;
+        len -= (size_t)n;
+    }
+
+    return 0;
+}
+
+int server_call(int fd, const server_request_t *request, server_reply_t *reply) {
+    if(transfer(fd, (void *)request, sizeof(*request), TRUE) != 0)
+        return -1;
+
+    return transfer(fd, reply, sizeof(*reply), FALSE);
+}
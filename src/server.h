@@ -0,0 +1,91 @@
+/**
+ *  @name   server
+ *  @brief  admission control daemon answering fixed size binary requests on a Unix domain socket
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  One admission_ctx_t lives for the whole run. Every request and every reply is 16 bytes of
+ *  host order U32 words, so a client on the same machine can write its structs as they are:
+ *
+ *      request     op          args
+ *                  SERVER_ADD      period, wcet, deadline      reply: id, R of the service
+ *                  SERVER_REMOVE   id                          reply: id
+ *                  SERVER_QUERY    id                          reply: id, R of the service
+ *                  SERVER_STATUS                               reply: services, U * 1e6
+ *                  SERVER_CLEAR                                reply: services retired
+ *
+ *      reply       op, status, id, value
+ *                  status is TRUE, FALSE (rejected, or no such id) or SERVER_EBADREQ
+ *
+ *  Requests are answered in the order each client sent them. Everything that arrives in one
+ *  poll wakeup, from every client, is one batch: its removes are applied first, then its
+ *  adds are placed together and verified by a single admission_refresh. Only if that pass
+ *  finds a miss are the batch's adds taken back and admitted one at a time, in arrival
+ *  order, with admission_add. The verdicts are those of handling the adds one at a time,
+ *  since every subset of a feasible set is feasible. A CLEAR ends the batch at its place,
+ *  so the requests before it are applied and answered first and those after it form the
+ *  next batch. Replies, the R of an add included, see the state at the end of their batch.
+*/
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "admission.h"
+
+#define SERVER_ADD          1
+#define SERVER_REMOVE       2
+#define SERVER_QUERY        3
+#define SERVER_STATUS       4
+#define SERVER_CLEAR        5
+
+#define SERVER_EBADREQ      (-1)
+
+// clients served at once, later connections wait in the listen backlog
+#define SERVER_MAX_CLIENTS  64
+
+// requests taken from one client per wakeup, the rest wait for the next batch
+#define SERVER_CLIENT_BATCH 256
+
+typedef struct {
+    U32_T   op;
+    U32_T   arg[3];
+} server_request_t;
+
+typedef struct {
+    U32_T   op;
+    int     status;
+    U32_T   id;
+    U32_T   value;
+} server_reply_t;
+
+typedef struct {
+    U64_T   batches;
+    U64_T   requests;
+    U64_T   fallbacks;      // batches whose adds had to be admitted one at a time
+} server_stats_t;
+
+/**
+ *  @brief  bind path, replacing a stale socket file, and serve until SIGINT or SIGTERM
+ *
+ *  @param  capacity    services the context starts with room for, it grows on demand
+ *
+ *  @return 0 after a clean shutdown, -1 with error set if the socket could not be set up
+*/
+int server_run(const char *path, U32_T capacity, server_stats_t *stats, char error[128]);
+
+/**
+ *  @brief  connect to a running server
+ *
+ *  @return the socket, or -1 with errno set
+*/
+int server_connect(const char *path);
+
+/**
+ *  @brief  one request and its reply over a connected socket, blocking
+ *
+ *  @return 0, or -1 if the connection failed
+*/
+int server_call(int fd, const server_request_t *request, server_reply_t *reply);
+
+#endif
@@ -0,0 +1,371 @@
+/**
+ *  @name   sim
+ *  @brief  event driven single core schedule simulator for RM, DM, EDF and LLF
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdlib.h>
+
+#include "sim.h"
+
+#define SIM_NOMEM   (-2)
+
+// binary min-heap of service indices, ties broken by index so runs are deterministic
+typedef struct {
+    U32_T       *slot;
+    U32_T       *pos;
+    long long   *key;
+    U32_T       count;
+} sim_heap_t;
+
+typedef struct {
+    U64_T       *release;
+    U64_T       *remaining;
+    U32_T       *backlog;
+    U32_T       *rank;          // fixed priority level of each service, 0 highest
+    sim_heap_t  ready;
+    sim_heap_t  releases;
+} sim_state_t;
+
+static inline int heap_less(const sim_heap_t *h, U32_T a, U32_T b) {
+    return h->key[a] < h->key[b] || (h->key[a] == h->key[b] && a < b);
+}
+
+static void heap_swap(sim_heap_t *h, U32_T i, U32_T j) {
+    U32_T t = h->slot[i];
+
+    h->slot[i] = h->slot[j];
+    h->slot[j] = t;
+    h->pos[h->slot[i]] = i;
+    h->pos[h->slot[j]] = j;
+}
+
+static void heap_up(sim_heap_t *h, U32_T i) {
+    while(i > 0 && heap_less(h, h->slot[i], h->slot[(i - 1) / 2]))
+    {
+        heap_swap(h, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+static void heap_down(sim_heap_t *h, U32_T i) {
+    U32_T l, best;
+
+    while((l = 2 * i + 1) < h->count)
+    {
+        best = l;
+        if(l + 1 < h->count && heap_less(h, h->slot[l + 1], h->slot[l]))
+            best = l + 1;
+        if(!heap_less(h, h->slot[best], h->slot[i]))
+            break;
+        heap_swap(h, i, best);
+        i = best;
+    }
+}
+
+static void heap_push(sim_heap_t *h, U32_T task, long long key) {
+    h->key[task] = key;
+    h->slot[h->count] = task;
+    h->pos[task] = h->count;
+    h->count++;
+    heap_up(h, h->count - 1);
+}
+
+static void heap_pop(sim_heap_t *h) {
+    h->count--;
+    if(h->count > 0)
+    {
+        h->slot[0] = h->slot[h->count];
+        h->pos[h->slot[0]] = 0;
+        heap_down(h, 0);
+    }
+}
+
+// change the key of the root, the only entry the simulator ever re-keys
+static void heap_rekey_top(sim_heap_t *h, long long key) {
+    long long old = h->key[h->slot[0]];
+
+    h->key[h->slot[0]] = key;
+    if(key > old)
+        heap_down(h, 0);
+}
+
+static U64_T gcd64(U64_T a, U64_T b) {
+    U64_T r;
+
+    while(b != 0)
+    {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+static void sim_emit(sim_result_t *res, U32_T task, U64_T start, U64_T length) {
+    sim_record_t *last;
+    U64_T chunk;
+
+    while(length > 0)
+    {
+        last = (res->count > 0) ? &res->timeline[res->count - 1] : NULL;
+
+        // extend the previous slice while it stays contiguous and its length fits
+        if(last != NULL && last->task == task && last->start + last->length == start &&
+           last->length < 0xFFFFFFFFu)
+        {
+            chunk = 0xFFFFFFFFu - last->length;
+            if(chunk > length)
+                chunk = length;
+            last->length += (U32_T)chunk;
+        }
+        else if(res->count < res->capacity)
+        {
+            chunk = (length > 0xFFFFFFFFu) ? 0xFFFFFFFFu : length;
+            res->timeline[res->count].start  = start;
+            res->timeline[res->count].length = (U32_T)chunk;
+            res->timeline[res->count].task   = task;
+            res->count++;
+        }
+        else
+        {
+            res->truncated = TRUE;
+            return;
+        }
+
+        start  += chunk;
+        length -= chunk;
+    }
+}
+
+static long long sim_key(int policy, U32_T i, const U32_T deadline[], const sim_state_t *st) {
+    switch(policy)
+    {
+        case SIM_RM:
+        case SIM_DM:    return (long long)st->rank[i];
+        case SIM_EDF:   return (long long)(st->release[i] + deadline[i]);
+        // laxity at t is (d - remaining) - t, and t is common to every waiting job
+        default:        return (long long)(st->release[i] + deadline[i]) - (long long)st->remaining[i];
+    }
+}
+
+static void sim_miss(sim_result_t *res, U32_T task, U64_T due) {
+    if(res->misses == 0 || due < res->firstMiss)
+    {
+        res->firstMiss     = due;
+        res->firstMissTask = task;
+    }
+    res->misses++;
+}
+
+// the columns sim_run_scratch lays out, in order: release and remaining, the ready and
+// release heap keys, then backlog, the slot and pos of both heaps and rank
+size_t sim_scratch_bytes(U32_T numServices) {
+    return (size_t)numServices * (2 * sizeof(U64_T) + 2 * sizeof(long long) + 6 * sizeof(U32_T));
+}
+
+int sim_run(U32_T numServices, const U32_T period[], const U32_T wcet[], const U32_T deadline[],
+            const U32_T order[], int policy, U64_T horizon, sim_result_t *result) {
+    void *mem;
+    int rc;
+
+    if(numServices == 0)
+        return sim_run_scratch(0, period, wcet, deadline, order, policy, horizon, NULL, result);
+
+    if((mem = malloc(sim_scratch_bytes(numServices))) == NULL)
+        return SIM_NOMEM;
+
+    rc = sim_run_scratch(numServices, period, wcet, deadline, order, policy, horizon, mem, result);
+    free(mem);
+    return rc;
+}
+
+int sim_run_scratch(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                    const U32_T deadline[], const U32_T order[], int policy, U64_T horizon,
+                    void *mem, sim_result_t *result) {
+    sim_state_t st;
+    U64_T now = 0, until, step, lcm = 1, dmax = 0, due;
+    long long lax, rival;
+    U32_T i, run, prev = SIM_IDLE, l;
+
+    result->count = 0;
+    result->truncated = FALSE;
+    result->jobs = result->misses = result->preemptions = 0;
+    result->firstMiss = 0;
+    result->firstMissTask = SIM_IDLE;
+    result->overloaded = (utilization_compare_one(numServices, period, wcet) > 0) ? TRUE : FALSE;
+
+    if(horizon == 0)
+    {
+        for(i = 0; i < numServices; i++)
+        {
+            step = period[i] / gcd64(lcm, period[i]);
+            if(__builtin_mul_overflow(lcm, step, &lcm))
+                return FEAS_OVERFLOW;
+            if(deadline[i] > dmax)
+                dmax = deadline[i];
+        }
+        if(__builtin_add_overflow(lcm, dmax, &horizon))
+            return FEAS_OVERFLOW;
+    }
+    result->horizon = horizon;
+
+    if(numServices == 0)
+    {
+        sim_emit(result, SIM_IDLE, 0, horizon);
+        return TRUE;
+    }
+
+    st.release        = (U64_T *)mem;
+    st.remaining      = st.release + numServices;
+    st.ready.key      = (long long *)(st.remaining + numServices);
+    st.releases.key   = st.ready.key + numServices;
+    st.backlog        = (U32_T *)(st.releases.key + numServices);
+    st.ready.slot     = st.backlog + numServices;
+    st.ready.pos      = st.ready.slot + numServices;
+    st.releases.slot  = st.ready.pos + numServices;
+    st.releases.pos   = st.releases.slot + numServices;
+    st.rank           = st.releases.pos + numServices;
+    st.ready.count    = 0;
+    st.releases.count = 0;
+
+    // the same levels, tie breaks included, as the analysis, the ready slots are free to
+    // hold priority_order's output until the first push
+    if(policy == SIM_RM || policy == SIM_DM)
+    {
+        if(order == NULL)
+        {
+            priority_order(numServices, period, deadline, (policy == SIM_RM) ? PRIO_RM : PRIO_DM,
+                           st.ready.slot);
+            order = st.ready.slot;
+        }
+        for(i = 0; i < numServices; i++)
+            st.rank[order[i]] = i;
+    }
+
+    // synchronous release at t = 0, the release heap holds each service's next release
+    for(i = 0; i < numServices; i++)
+    {
+        st.release[i]   = 0;
+        st.remaining[i] = wcet[i];
+        st.backlog[i]   = 0;
+        result->jobs++;
+        if(wcet[i] > 0)
+            heap_push(&st.ready, i, sim_key(policy, i, deadline, &st));
+        heap_push(&st.releases, i, (long long)period[i]);
+    }
+
+    while(now < horizon)
+    {
+        until = (U64_T)st.releases.key[st.releases.slot[0]];
+        if(until > horizon)
+            until = horizon;
+
+        if(st.ready.count == 0)
+        {
+            sim_emit(result, SIM_IDLE, now, until - now);
+            prev = SIM_IDLE;
+        }
+        else
+        {
+            run = st.ready.slot[0];
+            // prev is cleared on completion, so a different pick means prev was preempted
+            if(prev != SIM_IDLE && prev != run)
+                result->preemptions++;
+            prev = run;
+
+            if(now + st.remaining[run] < until)
+                until = now + st.remaining[run];
+
+            // LLF, the best waiting job is a child of the root, it overtakes once its laxity is strictly lower
+            if(policy == SIM_LLF && st.ready.count > 1)
+            {
+                l = 1;
+                if(st.ready.count > 2 && heap_less(&st.ready, st.ready.slot[2], st.ready.slot[1]))
+                    l = 2;
+                rival = st.ready.key[st.ready.slot[l]];
+                lax   = st.ready.key[run];
+                if(rival >= lax && now + (U64_T)(rival - lax) + 1 < until)
+                    until = now + (U64_T)(rival - lax) + 1;
+            }
+
+            step = until - now;
+            sim_emit(result, run, now, step);
+            st.remaining[run] -= step;
+
+            if(st.remaining[run] == 0)
+            {
+                due = st.release[run] + deadline[run];
+                if(until > due)
+                    sim_miss(result, run, due);
+
+                if(st.backlog[run] > 0)
+                {
+                    // the next queued job of this service takes its place
+                    st.backlog[run]--;
+                    st.release[run]  += period[run];
+                    st.remaining[run] = wcet[run];
+                    heap_pop(&st.ready);
+                    heap_push(&st.ready, run, sim_key(policy, run, deadline, &st));
+                }
+                else
+                {
+                    heap_pop(&st.ready);
+                }
+                prev = SIM_IDLE;
+            }
+            else if(policy == SIM_LLF)
+            {
+                heap_rekey_top(&st.ready, sim_key(policy, run, deadline, &st));
+            }
+        }
+
+        now = until;
+
+        // every release due now, a service still busy with an older job queues the new one
+        while(st.releases.count > 0 && (U64_T)st.releases.key[st.releases.slot[0]] == now && now < horizon)
+        {
+            i = st.releases.slot[0];
+            result->jobs++;
+
+            if(st.remaining[i] > 0)
+            {
+                st.backlog[i]++;
+            }
+            else
+            {
+                st.release[i]   = now;
+                st.remaining[i] = wcet[i];
+                if(wcet[i] > 0)
+                    heap_push(&st.ready, i, sim_key(policy, i, deadline, &st));
+            }
+
+            st.releases.key[i] += period[i];
+            heap_down(&st.releases, 0);
+        }
+    }
+
+    // jobs still owed work whose deadline fell inside the horizon
+    for(i = 0; i < numServices; i++)
+    {
+        if(st.remaining[i] == 0)
+            continue;
+
+        due = st.release[i] + deadline[i];
+        if(due < horizon)
+            sim_miss(result, i, due);
+
+        // queued jobs behind it are released T apart
+        for(l = 1; l <= st.backlog[i]; l++)
+        {
+            due += period[i];
+            if(due < horizon)
+                sim_miss(result, i, due);
+        }
+    }
+
+    return (result->misses == 0 && !result->overloaded) ? TRUE : FALSE;
+}
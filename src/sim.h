@@ -0,0 +1,90 @@
+/**
+ *  @name   sim
+ *  @brief  event driven single core schedule simulator for RM, DM, EDF and LLF
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stddef.h>
+
+#include "feasibility.h"
+
+#define SIM_RM      0
+#define SIM_DM      1
+#define SIM_EDF     2
+#define SIM_LLF     3
+
+#define SIM_IDLE    0xFFFFFFFFu
+
+/**
+ *  One run-length encoded slice of the timeline, service task (or SIM_IDLE) owns the CPU
+ *  over [start, start + length). Back to back slices of the same service are merged.
+*/
+typedef struct {
+    U64_T   start;
+    U32_T   length;
+    U32_T   task;
+} sim_record_t;
+
+/**
+ *  timeline and capacity are supplied by the caller and never reallocated, a full buffer
+ *  sets truncated and the simulation carries on with only the counters.
+*/
+typedef struct {
+    sim_record_t    *timeline;
+    U32_T           capacity;
+    U32_T           count;
+    int             truncated;
+    U64_T           horizon;
+    U64_T           jobs;
+    U64_T           misses;
+    U64_T           preemptions;
+    U64_T           firstMiss;
+    U32_T           firstMissTask;
+    int             overloaded;     // U > 1, a miss is certain even if none fell inside the horizon
+} sim_result_t;
+
+/**
+ *  @brief  simulate a synchronous release of every service over [0, horizon)
+ *
+ *  Time only advances from event to event (releases, completions and, for LLF, the instant
+ *  a waiting job's laxity drops below the running one's), so the cost scales with the
+ *  number of jobs rather than the length of the horizon. RM and DM take their levels from
+ *  order, or from priority_order, so the schedule uses the priorities the analysis does.
+ *  EDF and LLF ties
+ *  go to the lower index and LLF only preempts once a waiting job's laxity is strictly
+ *  lower, so equal laxities do not thrash between two jobs every tick. A job that misses its
+ *  deadline keeps running and later releases of the same service queue behind it.
+ *
+ *  @param  order   order[k] is the service at RM or DM level k, NULL takes priority_order's
+ *                  levels for the policy, EDF and LLF ignore it
+ *  @param  horizon 0 simulates one hyperperiod plus the largest deadline
+ *
+ *  @return TRUE if no deadline inside the horizon was missed, FALSE otherwise and for any
+ *          U > 1 set, whose backlog can outgrow the horizon before its first miss,
+ *          FEAS_OVERFLOW if horizon is 0 and the hyperperiod does not fit 64 bits,
+ *          -2 if the scratch state could not be allocated
+*/
+int sim_run(U32_T numServices, const U32_T period[], const U32_T wcet[], const U32_T deadline[],
+            const U32_T order[], int policy, U64_T horizon, sim_result_t *result);
+
+/**
+ *  @brief  bytes of queue state sim_run_scratch needs for numServices services
+*/
+size_t sim_scratch_bytes(U32_T numServices);
+
+/**
+ *  @brief  sim_run on caller supplied queue state, never allocates
+ *
+ *  @param  mem     at least sim_scratch_bytes(numServices) bytes aligned like malloc, see
+ *                  workspace_bytes
+*/
+int sim_run_scratch(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                    const U32_T deadline[], const U32_T order[], int policy, U64_T horizon,
+                    void *mem, sim_result_t *result);
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ *  @name   sink
+ *  @brief  JSON Lines, CSV and binary result records formatted straight into one buffer
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sink.h"
+
+// bytes buffered before a write, records larger than this grow the buffer instead
+#define SINK_BUFFER     (64 * 1024)
+
+// fixed part of the longest text record, the response times come on top
+#define SINK_RECORD_MAX 512
+
+// longest U32 in decimal plus a separator
+#define SINK_U32_MAX    11
+
+static const char csvHeader[] =
+    "set,n,utilization,lub,rm_lub,completion,sched_point,edf,gfb,bcl,global_fp,partitioned,resp\n";
+
+int sink_format(const char *name) {
+    static const char *names[] = { "jsonl", "csv", "bin" };
+    int k;
+
+    for(k = SINK_JSONL; k <= SINK_BINARY; k++)
+        if(strcmp(name, names[k]) == 0)
+            return k;
+
+    return -1;
+}
+
+int sink_flush(result_sink_t *sink) {
+    if(!sink->failed && sink->len > 0 && fwrite(sink->buf, 1, sink->len, sink->out) != sink->len)
+        sink->failed = TRUE;
+
+    sink->len = 0;
+    return sink->failed ? -1 : 0;
+}
+
+// room for need more bytes, flushing first and growing only for a record past the buffer
+static int sink_reserve(result_sink_t *sink, size_t need) {
+    char *grown;
+
+    if(sink->len + need <= sink->capacity)
+        return 0;
+
+    if(sink_flush(sink) != 0)
+        return -1;
+
+    if(need > sink->capacity)
+    {
+        grown = realloc(sink->buf, need);
+        if(grown == NULL)
+        {
+            sink->failed = TRUE;
+            return -1;
+        }
+        sink->buf      = grown;
+        sink->capacity = need;
+    }
+
+    return 0;
+}
+
+static inline void put_bytes(result_sink_t *sink, const char *bytes, size_t count) {
+    memcpy(sink->buf + sink->len, bytes, count);
+    sink->len += count;
+}
+
+#define put_literal(sink, text) put_bytes(sink, text, sizeof(text) - 1)
+
+static inline void put_u64(result_sink_t *sink, U64_T value) {
+    char digits[20];
+    int k = 0;
+
+    do
+    {
+        digits[k++] = (char)('0' + value % 10);
+        value /= 10;
+    } while(value != 0);
+
+    while(k > 0)
+        sink->buf[sink->len++] = digits[--k];
+}
+
+// six decimals without a trip through printf, the inputs are finite and non-negative
+static inline void put_fixed(result_sink_t *sink, double value) {
+    U64_T scaled = (U64_T)llround(value * 1e6);
+    U64_T frac = scaled % 1000000;
+    int k;
+
+    put_u64(sink, scaled / 1000000);
+    sink->buf[sink->len++] = '.';
+    for(k = 5; k >= 0; k--)
+    {
+        sink->buf[sink->len + k] = (char)('0' + frac % 10);
+        frac /= 10;
+    }
+    sink->len += 6;
+}
+
+static inline void put_verdict(result_sink_t *sink, int verdict) {
+    if(verdict == FEAS_OVERFLOW)
+        put_literal(sink, "-1");
+    else
+        sink->buf[sink->len++] = verdict ? '1' : '0';
+}
+
+// a multicore verdict, or the format's empty value when that analysis did not run
+static inline void put_optional(result_sink_t *sink, int ran, int verdict) {
+    if(ran)
+        put_verdict(sink, verdict);
+    else if(sink->format == SINK_JSONL)
+        put_literal(sink, "null");
+}
+
+int sink_open(result_sink_t *sink, FILE *out, int format) {
+    struct {
+        char    magic[8];
+        U32_T   version;
+        U32_T   recordSize;
+    } header = { "FEASRES1", SINK_VERSION, sizeof(sink_record_t) };
+
+    sink->out      = out;
+    sink->format   = format;
+    sink->len      = 0;
+    sink->failed   = FALSE;
+    sink->capacity = SINK_BUFFER;
+    sink->buf      = malloc(SINK_BUFFER);
+    if(sink->buf == NULL)
+        return -1;
+
+    if(format == SINK_CSV)
+        put_literal(sink, csvHeader);
+    else if(format == SINK_BINARY)
+        put_bytes(sink, (const char *)&header, sizeof(header));
+
+    return 0;
+}
+
+static void write_text(result_sink_t *sink, const feasibility_result_t *result,
+                       const U32_T resp[], U32_T n, U32_T id) {
+    int json = (sink->format == SINK_JSONL);
+    int global = (result->multicore & BATCH_GLOBAL) != 0;
+    int partitioned = (result->multicore & BATCH_PARTITIONED) != 0;
+    char sep = json ? ',' : ' ';
+    U32_T k;
+
+#define FIELD(name) do { if(json) put_literal(sink, ",\"" name "\":"); else put_literal(sink, ","); } while(0)
+
+    if(json)
+        put_literal(sink, "{\"set\":");
+    put_u64(sink, id);
+    FIELD("n");
+    put_u64(sink, n);
+    FIELD("utilization");
+    put_fixed(sink, result->utilization);
+    FIELD("lub");
+    put_fixed(sink, result->lub);
+    FIELD("rm_lub");
+    put_verdict(sink, result->rm_lub);
+    FIELD("completion");
+    put_verdict(sink, result->completion);
+    FIELD("sched_point");
+    put_verdict(sink, result->sched_point);
+    FIELD("edf");
+    put_verdict(sink, result->edf);
+    FIELD("gfb");
+    put_optional(sink, global, result->gfb);
+    FIELD("bcl");
+    put_optional(sink, global, result->bcl);
+    FIELD("global_fp");
+    put_optional(sink, global, result->global_fp);
+    FIELD("partitioned");
+    put_optional(sink, partitioned, result->partitioned);
+    FIELD("resp");
+
+#undef FIELD
+
+    if(json)
+        sink->buf[sink->len++] = '[';
+    for(k = 0; resp != NULL && k < n; k++)
+    {
+        if(k > 0)
+            sink->buf[sink->len++] = sep;
+        put_u64(sink, resp[k]);
+    }
+    if(json)
+        put_literal(sink, "]}");
+    sink->buf[sink->len++] = '\n';
+}
+
+static void write_binary(result_sink_t *sink, const feasibility_result_t *result,
+                         const U32_T resp[], U32_T n, U32_T id) {
+    sink_record_t record;
+
+    memset(&record, 0, sizeof(record));
+    record.set         = id;
+    record.numServices = n;
+    record.utilization = result->utilization;
+    record.lub         = result->lub;
+    record.rm_lub      = (signed char)result->rm_lub;
+    record.completion  = (signed char)result->completion;
+    record.sched_point = (signed char)result->sched_point;
+    record.edf         = result->edf;
+    record.gfb         = (result->multicore & BATCH_GLOBAL) ? result->gfb : SINK_NOT_RUN;
+    record.bcl         = (result->multicore & BATCH_GLOBAL) ? result->bcl : SINK_NOT_RUN;
+    record.global_fp   = (result->multicore & BATCH_GLOBAL) ? result->global_fp : SINK_NOT_RUN;
+    record.partitioned = (result->multicore & BATCH_PARTITIONED) ? result->partitioned : SINK_NOT_RUN;
+
+    put_bytes(sink, (const char *)&record, sizeof(record));
+    if(resp != NULL)
+        put_bytes(sink, (const char *)resp, sizeof(U32_T) * n);
+    else
+    {
+        memset(sink->buf + sink->len, 0, sizeof(U32_T) * n);
+        sink->len += sizeof(U32_T) * n;
+    }
+}
+
+int sink_write(result_sink_t *sink, const taskset_batch_t *batch,
+               const feasibility_result_t results[], const U32_T resp[], U32_T firstId) {
+    U32_T s, n, base;
+    const U32_T *setResp;
+
+    for(s = 0; s < batch->numSets; s++)
+    {
+        base    = batch->offset[s] - batch->offset[0];
+        n       = batch->offset[s + 1] - batch->offset[s];
+        setResp = (resp != NULL) ? resp + base : NULL;
+
+        if(sink_reserve(sink, SINK_RECORD_MAX + (size_t)n * SINK_U32_MAX) != 0)
+            return -1;
+
+        if(sink->format == SINK_BINARY)
+            write_binary(sink, &results[s], setResp, n, firstId + s);
+        else
+            write_text(sink, &results[s], setResp, n, firstId + s);
+    }
+
+    return sink->failed ? -1 : 0;
+}
+
+int sink_close(result_sink_t *sink) {
+    int rc = sink_flush(sink);
+
+    free(sink->buf);
+    sink->buf = NULL;
+    return rc;
+}
@@ -0,0 +1,109 @@
+/**
+ *  @name   sink
+ *  @brief  buffered machine readable result records, one per task set
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  Every record carries the set id, service count, utilization, LUB, every verdict of
+ *  feasibility_result_t and the completion test response time of each service, in file
+ *  order (see feasibility_batch_range for the 0 entries). Verdicts are 1 feasible,
+ *  0 infeasible, -1 overflow, multicore verdicts that did not run are null / empty / 0xFF.
+ *
+ *  SINK_JSONL, one object per line:
+ *
+ *      {"set":0,"n":3,"utilization":0.733333,"lub":0.779763,"rm_lub":1,"completion":1,
+ *       "sched_point":1,"edf":1,"gfb":null,"bcl":null,"global_fp":null,"partitioned":null,
+ *       "resp":[1,2,6]}
+ *
+ *  SINK_CSV, a header row then one row per set, resp as space separated values.
+ *
+ *  SINK_BINARY, host byte order, a 16 byte stream header then one record per set:
+ *
+ *      0   char    magic[8]        "FEASRES1"
+ *      8   U32     version         SINK_VERSION
+ *      12  U32     recordSize      sizeof(sink_record_t)
+ *
+ *  each record a sink_record_t followed by U32 resp[numServices].
+*/
+
+#ifndef SINK_H
+#define SINK_H
+
+#include <stdio.h>
+
+#include "batch.h"
+
+// formats, the human readable lines stay with report_batch
+#define SINK_JSONL      0
+#define SINK_CSV        1
+#define SINK_BINARY     2
+
+#define SINK_VERSION    1
+
+// multicore verdict that was not computed, binary records only
+#define SINK_NOT_RUN    0xFF
+
+typedef struct {
+    U32_T           set;
+    U32_T           numServices;
+    double          utilization;
+    double          lub;
+    signed char     rm_lub;
+    signed char     completion;
+    signed char     sched_point;
+    signed char     edf;
+    unsigned char   gfb;
+    unsigned char   bcl;
+    unsigned char   global_fp;
+    unsigned char   partitioned;
+} sink_record_t;
+
+typedef struct {
+    FILE    *out;
+    int     format;
+    char    *buf;
+    size_t  len;
+    size_t  capacity;
+    int     failed;
+} result_sink_t;
+
+/**
+ *  @brief  set up a sink writing format to out, the CSV header or binary stream header
+ *          goes into the buffer right away
+ *
+ *  @return 0, or -1 if the buffer could not be allocated
+*/
+int sink_open(result_sink_t *sink, FILE *out, int format);
+
+/**
+ *  @brief  append one record per set of the batch, sets numbered from firstId
+ *
+ *  @param  resp    response times as feasibility_batch_range writes them, NULL writes
+ *                  empty lists
+ *
+ *  @return 0, or -1 once a write to out has failed
+*/
+int sink_write(result_sink_t *sink, const taskset_batch_t *batch,
+               const feasibility_result_t results[], const U32_T resp[], U32_T firstId);
+
+/**
+ *  @brief  write out whatever is buffered
+ *
+ *  @return 0, or -1 if this or an earlier write failed
+*/
+int sink_flush(result_sink_t *sink);
+
+/**
+ *  @brief  flush and release the buffer, out stays open
+ *
+ *  @return sink_flush result
+*/
+int sink_close(result_sink_t *sink);
+
+/**
+ *  @brief  SINK_* format for a command line name, jsonl, csv or bin, -1 if unknown
+*/
+int sink_format(const char *name);
+
+#endif
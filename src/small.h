@@ -0,0 +1,109 @@
+/**
+ *  @name   small
+ *  @brief  fixed priority feasibility for 3 and 4 service sets as constant expressions and
+ *          branch-free unrolled kernels
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  @cite   Bini, Enrico, and Giorgio C. Buttazzo. "Schedulability analysis of periodic fixed
+ *          priority systems." IEEE Transactions on Computers 53.11 (2004): 1462-1473.
+*/
+
+#ifndef SMALL_H
+#define SMALL_H
+
+#include "feasibility.h"
+
+// largest set the unrolled kernels take, smaller sets are padded with idle services
+#define SMALL_MAX_SERVICES  4
+
+/**
+ *  With at most three services above it, the Bini and Buttazzo point set of a service has a
+ *  fixed shape, P(i-1)(D(i)) is at most 2^i points reached by flooring D(i) onto the periods
+ *  above it in every combination. Service i is feasible iff C(i) = 0 or its level demand
+ *  W(i, t) = C(i) + sum_j<i ceil(t/T(j))*C(j) fits in t at one of those points, which is the
+ *  same verdict as the completion test. The macros below spell that out with no loops, so they
+ *  are integer constant expressions on constant arguments (usable in _Static_assert) and
+ *  straight line code on runtime ones, combined with & and | instead of && and ||.
+ *
+ *  Every deadline must be at most its period, past that the reduced point set can miss the
+ *  fixed point of a service. Arguments are evaluated many times, pass constants or side
+ *  effect free lvalues. Terms are saturated at 2^33 so the 64 bit sums cannot wrap.
+*/
+#define SMALL_U(x)              ((unsigned long long)(x))
+#define SMALL_SAT(x)            ((x) > 0x200000000ull ? 0x200000000ull : (x))
+#define SMALL_FLOOR(t, T)       ((t) / SMALL_U(T) * SMALL_U(T))
+#define SMALL_CEIL(t, T)        ((t) / SMALL_U(T) + ((t) % SMALL_U(T) != 0))
+#define SMALL_TERM(t, T, C)     SMALL_SAT(SMALL_CEIL(t, T) * SMALL_U(C))
+
+// W(i, t) <= t with up to three services above, absent ones passed as T = 1, C = 0
+#define SMALL_FITS(t, T0, C0, T1, C1, T2, C2, Ci)                                           \
+    (SMALL_U(Ci) + SMALL_TERM(t, T0, C0) + SMALL_TERM(t, T1, C1) + SMALL_TERM(t, T2, C2)    \
+     <= (t))
+
+// the point sets P(0)(t), P(1)(t) and P(2)(t)
+#define SMALL_P0(t, T0, C0, T1, C1, T2, C2, Ci)                                             \
+    (SMALL_FITS(t, T0, C0, T1, C1, T2, C2, Ci) |                                            \
+     SMALL_FITS(SMALL_FLOOR(t, T0), T0, C0, T1, C1, T2, C2, Ci))
+#define SMALL_P1(t, T0, C0, T1, C1, T2, C2, Ci)                                             \
+    (SMALL_P0(t, T0, C0, T1, C1, T2, C2, Ci) |                                              \
+     SMALL_P0(SMALL_FLOOR(t, T1), T0, C0, T1, C1, T2, C2, Ci))
+#define SMALL_P2(t, T0, C0, T1, C1, T2, C2, Ci)                                             \
+    (SMALL_P1(t, T0, C0, T1, C1, T2, C2, Ci) |                                              \
+     SMALL_P1(SMALL_FLOOR(t, T2), T0, C0, T1, C1, T2, C2, Ci))
+
+/**
+ *  @brief  1 if the four services, highest priority first, are feasible under fixed priority
+*/
+#define SMALL_FP4(T0, C0, D0, T1, C1, D1, T2, C2, D2, T3, C3, D3)                           \
+    ((SMALL_U(C0) <= SMALL_U(D0)) &                                                         \
+     ((SMALL_U(C1) == 0) | SMALL_P0(SMALL_U(D1), T0, C0, 1, 0, 1, 0, C1)) &                 \
+     ((SMALL_U(C2) == 0) | SMALL_P1(SMALL_U(D2), T0, C0, T1, C1, 1, 0, C2)) &               \
+     ((SMALL_U(C3) == 0) | SMALL_P2(SMALL_U(D3), T0, C0, T1, C1, T2, C2, C3)))
+
+/**
+ *  @brief  SMALL_FP4 for three services
+*/
+#define SMALL_FP3(T0, C0, D0, T1, C1, D1, T2, C2, D2)                                       \
+    SMALL_FP4(T0, C0, D0, T1, C1, D1, T2, C2, D2, 1, 0, 1)
+
+/**
+ *  @brief  SMALL_FP3 and SMALL_FP4 for T = D sets, e.g. the built in examples
+*/
+#define SMALL_RM3(T0, C0, T1, C1, T2, C2)                                                   \
+    SMALL_FP3(T0, C0, T0, T1, C1, T1, T2, C2, T2)
+#define SMALL_RM4(T0, C0, T1, C1, T2, C2, T3, C3)                                           \
+    SMALL_FP4(T0, C0, T0, T1, C1, T1, T2, C2, T2, T3, C3, T3)
+
+/**
+ *  @brief  unrolled completion test of a set of at most SMALL_MAX_SERVICES services
+ *
+ *  Agrees with response_time_analysis(_order) on every D <= T set, the point count and so
+ *  the work is the same for every input. Sets of 1 to 3 services are padded with idle lowest
+ *  priority ones.
+ *
+ *  @param  order   level order as for response_time_analysis_order, NULL for index order
+ *
+ *  @return TRUE if every service meets its deadline, FALSE otherwise
+*/
+static inline int small_feasibility(U32_T numServices, const U32_T period[], const U32_T wcet[],
+                                    const U32_T deadline[], const U32_T order[]) {
+    U32_T T[SMALL_MAX_SERVICES] = { 1, 1, 1, 1 };
+    U32_T C[SMALL_MAX_SERVICES] = { 0, 0, 0, 0 };
+    U32_T D[SMALL_MAX_SERVICES] = { 1, 1, 1, 1 };
+    U32_T k, i;
+
+    for(k = 0; k < numServices; k++)
+    {
+        i    = (order == NULL) ? k : order[k];
+        T[k] = period[i];
+        C[k] = wcet[i];
+        D[k] = deadline[i];
+    }
+
+    return SMALL_FP4(T[0], C[0], D[0], T[1], C[1], D[1], T[2], C[2], D[2], T[3], C[3], D[3])
+           ? TRUE : FALSE;
+}
+
+#endif
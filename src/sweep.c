@@ -0,0 +1,143 @@
+/**
+ *  @name   sweep
+ *  @brief  acceptance ratio of every test over a grid of generated utilizations and set sizes
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sweep.h"
+
+// "a", "a-b" or "a-b:step", a missing step keeps the one given
+static int parse_axis(const char *text, double *lo, double *hi, double *step) {
+    char *end;
+
+    *lo = strtod(text, &end);
+    *hi = *lo;
+    if(end != text && *end == '-')
+        *hi = strtod(end + 1, &end);
+    if(*end == ':')
+        *step = strtod(end + 1, &end);
+
+    return (end != text && *end == '\0') ? TRUE : FALSE;
+}
+
+int sweep_parse(sweep_grid_t *grid, const char *spec, char error[128]) {
+    char buf[256], *pair, *value, *next;
+    double lo, hi, step;
+    int ok;
+
+    if(strlen(spec) >= sizeof(buf))
+    {
+        snprintf(error, 128, "sweep spec longer than %zu characters", sizeof(buf) - 1);
+        return -1;
+    }
+    strcpy(buf, spec);
+
+    for(pair = buf; pair != NULL && *pair != '\0'; pair = next)
+    {
+        if((next = strchr(pair, ',')) != NULL)
+            *next++ = '\0';
+
+        ok = FALSE;
+        if((value = strchr(pair, '=')) != NULL)
+        {
+            *value++ = '\0';
+            if(strcmp(pair, "u") == 0)
+            {
+                step = grid->uStep;
+                if((ok = parse_axis(value, &lo, &hi, &step)))
+                {
+                    grid->uMin  = lo;
+                    grid->uMax  = hi;
+                    grid->uStep = step;
+                }
+            }
+            else if(strcmp(pair, "n") == 0)
+            {
+                step = (double)grid->nStep;
+                if((ok = parse_axis(value, &lo, &hi, &step) && lo >= 1.0 && hi <= 4294967295.0 &&
+                         step >= 1.0))
+                {
+                    grid->nMin  = (U32_T)lo;
+                    grid->nMax  = (U32_T)hi;
+                    grid->nStep = (U32_T)step;
+                }
+            }
+        }
+
+        if(!ok)
+        {
+            snprintf(error, 128, "bad sweep setting '%.96s'", pair);
+            return -1;
+        }
+    }
+
+    if(!(grid->uMin > 0.0) || grid->uMax < grid->uMin || !(grid->uStep > 0.0) ||
+       grid->nMax < grid->nMin || sweep_u_steps(grid) > SWEEP_MAX_STEPS ||
+       sweep_n_steps(grid) > SWEEP_MAX_STEPS)
+    {
+        snprintf(error, 128, "sweep needs 0 < u min <= max, min <= max for n, positive steps and at most %u points per axis",
+                 SWEEP_MAX_STEPS);
+        return -1;
+    }
+
+    return 0;
+}
+
+U32_T sweep_u_steps(const sweep_grid_t *grid) {
+    double steps = floor((grid->uMax - grid->uMin) / grid->uStep + 1e-9);
+
+    // a range that does not divide evenly stops at the last step inside it
+    return (steps >= (double)SWEEP_MAX_STEPS) ? SWEEP_MAX_STEPS + 1 : (U32_T)steps + 1;
+}
+
+U32_T sweep_n_steps(const sweep_grid_t *grid) {
+    return (grid->nMax - grid->nMin) / grid->nStep + 1;
+}
+
+void sweep_cell_init(sweep_cell_t *cell, const sweep_grid_t *grid, U32_T k) {
+    U32_T uSteps = sweep_u_steps(grid);
+
+    memset(cell, 0, sizeof(*cell));
+    cell->numServices = grid->nMin + (k / uSteps) * grid->nStep;
+
+    // from the start of the axis each time, repeated adds would drift off the grid
+    cell->utilization = grid->uMin + (double)(k % uSteps) * grid->uStep;
+}
+
+void sweep_accumulate(sweep_cell_t *cell, const feasibility_result_t results[], U32_T count) {
+    const feasibility_result_t *r;
+    double delta;
+    U32_T s;
+
+    for(s = 0; s < count; s++)
+    {
+        r = &results[s];
+
+        cell->sets++;
+        delta        = r->utilization - cell->meanU;
+        cell->meanU += delta / (double)cell->sets;
+        cell->m2U   += delta * (r->utilization - cell->meanU);
+
+        cell->accepted[SWEEP_RM_LUB]      += (r->rm_lub == TRUE);
+        cell->accepted[SWEEP_COMPLETION]  += (r->completion == TRUE);
+        cell->accepted[SWEEP_SCHED_POINT] += (r->sched_point == TRUE);
+        cell->accepted[SWEEP_EDF]         += (r->edf == TRUE);
+
+        cell->multicore |= r->multicore;
+        if(r->multicore & BATCH_GLOBAL)
+        {
+            cell->accepted[SWEEP_GFB]       += (r->gfb == TRUE);
+            cell->accepted[SWEEP_BCL]       += (r->bcl == TRUE);
+            cell->accepted[SWEEP_GLOBAL_FP] += (r->global_fp == TRUE);
+        }
+        if(r->multicore & BATCH_PARTITIONED)
+            cell->accepted[SWEEP_PARTITIONED] += (r->partitioned == TRUE);
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ *  @name   sweep
+ *  @brief  acceptance ratio of every test over a grid of generated utilizations and set sizes
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  A sweep is cells of (n, U), n outermost, each of the same number of generated sets. A
+ *  cell only keeps counters that every analyzed chunk is folded into and then dropped, so
+ *  memory does not depend on the number of sets. Cell c generates the sets
+ *  [c * sets, (c + 1) * sets) of the stream, no two sets of a sweep share a draw.
+*/
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include "batch.h"
+
+// tests a cell counts acceptances of, in output order
+#define SWEEP_RM_LUB        0
+#define SWEEP_COMPLETION    1
+#define SWEEP_SCHED_POINT   2
+#define SWEEP_EDF           3
+#define SWEEP_GFB           4       // only counted with a multicore analysis
+#define SWEEP_BCL           5
+#define SWEEP_GLOBAL_FP     6
+#define SWEEP_PARTITIONED   7
+#define SWEEP_TESTS         8
+
+// largest number of steps on one axis
+#define SWEEP_MAX_STEPS     100000
+
+typedef struct {
+    double  uMin;
+    double  uMax;
+    double  uStep;
+    U32_T   nMin;
+    U32_T   nMax;
+    U32_T   nStep;
+} sweep_grid_t;
+
+typedef struct {
+    U32_T   numServices;
+    double  utilization;        // the target U of the cell
+    U64_T   sets;
+    double  meanU;              // of the generated sets, after WCET rounding
+    double  m2U;                // Welford sum of squared deviations of U
+    U64_T   accepted[SWEEP_TESTS];
+    int     multicore;          // BATCH_* flags seen in the cell
+} sweep_cell_t;
+
+/**
+ *  @brief  apply comma separated key=value pairs on top of grid
+ *
+ *  Keys: u=min-max:step and n=min-max:step, a single value fixes the axis. Example:
+ *  u=0.05-1:0.05,n=4-32:4
+ *
+ *  @return 0, or -1 with error describing the first bad pair or an empty axis
+*/
+int sweep_parse(sweep_grid_t *grid, const char *spec, char error[128]);
+
+/**
+ *  @brief  points on the U and n axes
+*/
+U32_T sweep_u_steps(const sweep_grid_t *grid);
+U32_T sweep_n_steps(const sweep_grid_t *grid);
+
+/**
+ *  @brief  empty cell k of the grid, U varying fastest
+*/
+void sweep_cell_init(sweep_cell_t *cell, const sweep_grid_t *grid, U32_T k);
+
+/**
+ *  @brief  fold count analyzed sets into the cell
+*/
+void sweep_accumulate(sweep_cell_t *cell, const feasibility_result_t results[], U32_T count);
+
+#endif
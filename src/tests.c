@@ -0,0 +1,269 @@
+/**
+ *  @name   tests
+ *  @brief  regression checks for the kernels, built and run by make test
+ *
+ *  @author Mark Sherman
+ *  @date   10/15/2026
+ *
+ *  Each check prints what failed and counts it, main exits 1 if any did. Only what the
+ *  compile time checks next to the examples cannot evaluate lives here.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "admission.h"
+#include "blocking.h"
+#include "cache.h"
+#include "feasibility.h"
+#include "loader.h"
+
+static U32_T failures = 0;
+
+#define CHECK(cond, ...)                                                                    \
+    do {                                                                                    \
+        if(!(cond))                                                                         \
+        {                                                                                   \
+            fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);                                 \
+            fprintf(stderr, __VA_ARGS__);                                                   \
+            fputc('\n', stderr);                                                            \
+            failures++;                                                                     \
+        }                                                                                   \
+    } while(0)
+
+static unsigned long long rng_state = 1;
+
+// xorshift64*, the same stream on every platform
+static U32_T rng_below(U32_T bound) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (U32_T)(((rng_state * 2685821657736338717ull) >> 32) % bound);
+}
+
+// every cached R of the context against the completion test of the same services
+static void check_admission_resp(admission_ctx_t *ctx, const U32_T id[], U32_T numIds,
+                                 const char *what) {
+    U32_T resp[16], r, k, i;
+    int feasible;
+
+    feasible = response_time_analysis(ctx->count, ctx->period, ctx->wcet, ctx->deadline, resp);
+    CHECK(feasible, "%s: the admitted set fails response_time_analysis", what);
+    if(!feasible)
+        return;
+
+    for(k = 0; k < numIds; k++)
+    {
+        if(!admission_response(ctx, id[k], &r))
+            continue;
+        for(i = 0; i < ctx->count && ctx->id[i] != id[k]; i++)
+            ;
+        CHECK(r == resp[i], "%s: service %u has R = %u, response_time_analysis gives %u", what,
+              i, r, resp[i]);
+    }
+}
+
+// D > T services cache the worst job of their busy window, which must not warm start a
+// later first job fixed point
+static void test_admission_busy_window(void) {
+    static const U32_T period[]   = { 8, 32, 37, 40, 42 };
+    static const U32_T wcet[]     = { 0, 10, 12, 2, 13 };
+    static const U32_T deadline[] = { 2, 19, 36, 81, 120 };
+    U32_T id[16], p[16], c[16], d[16];
+    U32_T T, C, D, k, i, pos, numIds, set;
+    admission_ctx_t ctx;
+    int added;
+
+    if(admission_init(&ctx, 16) != 0)
+    {
+        CHECK(FALSE, "admission_init failed");
+        return;
+    }
+
+    for(k = 0; k < 5; k++)
+        CHECK(admission_add(&ctx, period[k], wcet[k], deadline[k], &id[k]) == TRUE,
+              "the D > T example rejects service %u", k);
+    check_admission_resp(&ctx, id, 5, "D > T example");
+
+    // random D up to 3T sets added one service at a time, every verdict and R must match
+    for(set = 0; set < 5000; set++)
+    {
+        admission_clear(&ctx);
+        numIds = 0;
+
+        for(k = 0; k < 8; k++)
+        {
+            T = 4 + rng_below(60);
+            C = rng_below(T / 3 + 1);
+            D = C + 1 + rng_below(3 * T);
+
+            // the grown set in the order admission_add keeps, shorter T then shorter D first
+            for(pos = 0; pos < ctx.count; pos++)
+                if(T < ctx.period[pos] || (T == ctx.period[pos] && D < ctx.deadline[pos]))
+                    break;
+            for(i = 0; i <= ctx.count; i++)
+            {
+                p[i] = (i < pos) ? ctx.period[i] : (i == pos) ? T : ctx.period[i - 1];
+                c[i] = (i < pos) ? ctx.wcet[i] : (i == pos) ? C : ctx.wcet[i - 1];
+                d[i] = (i < pos) ? ctx.deadline[i] : (i == pos) ? D : ctx.deadline[i - 1];
+            }
+
+            added = admission_add(&ctx, T, C, D, &id[numIds]);
+            CHECK(added == response_time_analysis(ctx.count + (added ? 0 : 1), p, c, d, NULL),
+                  "set %u: admission_add of (%u, %u, %u) returns %d", set, T, C, D, added);
+            if(added == TRUE)
+                numIds++;
+        }
+
+        check_admission_resp(&ctx, id, numIds, "random D > T set");
+    }
+
+    admission_destroy(&ctx);
+}
+
+// a D > T set whose first job is not the worst one, S2's fifth job completes 118 after its
+// release where the first takes 114, so every analysis must reject it with R = 118
+static void test_busy_window_reject(void) {
+    static const U32_T period[]   = { 70, 100 };
+    static const U32_T wcet[]     = { 26, 62 };
+    static const U32_T deadline[] = { 70, 116 };
+    blocking_table_t table;
+    U32_T resp[2] = { 0, 0 };
+
+    CHECK(!response_time_analysis(2, period, wcet, deadline, resp) && resp[1] == 118,
+          "response_time_analysis gives R = %u for the D > T set", resp[1]);
+
+    resp[1] = 0;
+    blocking_table_init(&table);
+    CHECK(blocking_table_build(&table, 2, period, wcet, deadline, NULL, NULL) == 0 &&
+          !blocking_rta(&table, resp) && resp[1] == 118,
+          "blocking_rta gives R = %u for the D > T set", resp[1]);
+    blocking_table_free(&table);
+}
+
+// a binary stream of raw U32 words
+static FILE *binary_input(const U32_T words[], size_t count) {
+    FILE *f = tmpfile();
+
+    if(f != NULL && (fwrite(words, sizeof(U32_T), count, f) != count || fseek(f, 0, SEEK_SET) != 0))
+    {
+        fclose(f);
+        f = NULL;
+    }
+
+    return f;
+}
+
+// record counts straight from a crafted file must be rejected, not trusted to size the arena
+static void test_loader_counts(void) {
+    static const U32_T wrap[]    = { 1, 10, 1, 10, 0xFFFFFFFFu, 5, 1, 5, 5, 1, 5 };
+    static const U32_T huge[]    = { 0x90000000u, 5, 1, 5 };
+    static const U32_T claimed[] = { 0x08000000u, 5, 1, 5, 5, 1, 5 };
+    static const struct { const U32_T *words; size_t count; const char *what; } cases[] = {
+        { wrap, sizeof(wrap) / sizeof(wrap[0]), "n = 2^32 - 1 after a one service set" },
+        { huge, sizeof(huge) / sizeof(huge[0]), "n past LOADER_MAX_TASKS" },
+        { claimed, sizeof(claimed) / sizeof(claimed[0]), "n far past the records that follow" },
+    };
+    taskset_arena_t arena;
+    loader_t loader;
+    FILE *in;
+    U32_T k;
+
+    taskset_arena_init(&arena);
+    for(k = 0; k < sizeof(cases) / sizeof(cases[0]); k++)
+    {
+        if((in = binary_input(cases[k].words, cases[k].count)) == NULL)
+        {
+            CHECK(FALSE, "%s: cannot write the input", cases[k].what);
+            continue;
+        }
+
+        loader_init(&loader, in, LOADER_BINARY);
+        CHECK(loader_next(&loader, &arena, 16) == -1, "%s: accepted", cases[k].what);
+        CHECK(arena.taskCapacity <= 4096, "%s: arena grew to %u services", cases[k].what,
+              arena.taskCapacity);
+        loader_free(&loader);
+        fclose(in);
+    }
+    taskset_arena_free(&arena);
+}
+
+// an empty set next to a real one must survive a save and load, as -K runs do back to back
+static void test_cache_round_trip(void) {
+    static const U32_T period[]   = { 2, 10, 15 };
+    static const U32_T wcet[]     = { 1, 1, 2 };
+    static const U32_T resp[]     = { 1, 2, 6 };
+    static const char magic[8]    = { 'F', 'E', 'A', 'S', 'M', 'E', 'M', 'O' };
+    char path[] = "/tmp/feasibility-tests-XXXXXX";
+    signed char completion, schedPoint, edf;
+    U32_T out[3], version = CACHE_VERSION, count = 1;
+    cache_entry_t empty;
+    feas_cache_t cache;
+    cache_key_t key, none;
+    FILE *f;
+    int fd;
+
+    if((fd = mkstemp(path)) < 0)
+    {
+        CHECK(FALSE, "cannot create a cache file");
+        return;
+    }
+    close(fd);
+
+    if(cache_init(&cache, 64) != 0)
+    {
+        CHECK(FALSE, "cache_init failed");
+        unlink(path);
+        return;
+    }
+    cache_key(&key, 3, period, wcet, period, NULL);
+    cache_key(&none, 0, period, wcet, period, NULL);
+    cache_insert(&cache, &key, NULL, TRUE, TRUE, TRUE, resp);
+    cache_insert(&cache, &none, NULL, TRUE, TRUE, TRUE, NULL);
+    CHECK(cache_save(&cache, path) == 0, "cache_save: %s", cache.error);
+    cache_free(&cache);
+
+    cache_init(&cache, 64);
+    CHECK(cache_load(&cache, path) == 1, "cache_load of the saved cache: %s", cache.error);
+    CHECK(cache_lookup(&cache, &key, NULL, &completion, &schedPoint, &edf, out) &&
+          completion == TRUE && edf == TRUE && memcmp(out, resp, sizeof(out)) == 0,
+          "the saved set does not come back");
+    CHECK(!cache_lookup(&cache, &none, NULL, &completion, &schedPoint, &edf, NULL),
+          "the empty set was memoized");
+    cache_free(&cache);
+
+    // a file from before empty sets were kept out loads without them
+    memset(&empty, 0, sizeof(empty));
+    empty.key[0] = 1;
+    if((f = fopen(path, "wb")) != NULL)
+    {
+        fwrite(magic, 1, sizeof(magic), f);
+        fwrite(&version, sizeof(version), 1, f);
+        fwrite(&count, sizeof(count), 1, f);
+        fwrite(&empty, sizeof(empty), 1, f);
+        fclose(f);
+    }
+    cache_init(&cache, 64);
+    CHECK(cache_load(&cache, path) == 0, "cache_load of an empty set entry: %s", cache.error);
+    cache_free(&cache);
+
+    unlink(path);
+}
+
+int main(void) {
+    test_busy_window_reject();
+    test_admission_busy_window();
+    test_loader_counts();
+    test_cache_round_trip();
+
+    if(failures > 0)
+    {
+        fprintf(stderr, "%u checks failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ *  @name   workspace
+ *  @brief  per thread analysis scratch that outlives a batch call and only ever grows
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "workspace.h"
+
+void workspace_init(feas_workspace_t *ws) {
+    memset(ws, 0, sizeof(*ws));
+    global_table_init(&ws->table);
+}
+
+void workspace_free(feas_workspace_t *ws) {
+    global_table_free(&ws->table);
+    if(ws->partCores > 0)
+        partition_destroy(&ws->part);
+    free(ws->order);
+    free(ws->coreOf);
+    free(ws->bytes);
+    memset(ws, 0, sizeof(*ws));
+}
+
+int workspace_reserve(feas_workspace_t *ws, U32_T numServices) {
+    U32_T *order, *coreOf;
+
+    if(numServices <= ws->capacity)
+        return 0;
+
+    order = realloc(ws->order, sizeof(U32_T) * numServices);
+    if(order != NULL)
+        ws->order = order;
+    coreOf = realloc(ws->coreOf, sizeof(U32_T) * numServices);
+    if(coreOf != NULL)
+        ws->coreOf = coreOf;
+    ws->grows++;
+
+    if(order == NULL || coreOf == NULL)
+        return -1;
+
+    ws->capacity = numServices;
+    return 0;
+}
+
+partition_t *workspace_partition(feas_workspace_t *ws, U32_T numCores) {
+    if(ws->partCores == numCores)
+        return &ws->part;
+
+    if(ws->partCores > 0)
+        partition_destroy(&ws->part);
+    ws->partCores = 0;
+    ws->grows++;
+
+    if(partition_init(&ws->part, numCores) != 0)
+        return NULL;
+
+    ws->partCores = numCores;
+    return &ws->part;
+}
+
+void *workspace_bytes(feas_workspace_t *ws, size_t size) {
+    void *grown;
+
+    if(size <= ws->byteCapacity)
+        return ws->bytes;
+
+    // the contents are scratch, so a fresh block saves the copy realloc would make
+    grown = malloc(size);
+    if(grown == NULL)
+        return NULL;
+    free(ws->bytes);
+    ws->bytes        = grown;
+    ws->byteCapacity = size;
+    ws->grows++;
+
+    return grown;
+}
+
+feas_workspace_t *workspace_array(U32_T count) {
+    feas_workspace_t *ws = malloc(sizeof(feas_workspace_t) * (count > 0 ? count : 1));
+    U32_T k;
+
+    if(ws == NULL)
+        return NULL;
+
+    for(k = 0; k < count; k++)
+        workspace_init(&ws[k]);
+
+    return ws;
+}
+
+void workspace_array_free(feas_workspace_t *ws, U32_T count) {
+    U32_T k;
+
+    if(ws == NULL)
+        return;
+
+    for(k = 0; k < count; k++)
+        workspace_free(&ws[k]);
+    free(ws);
+}
@@ -0,0 +1,74 @@
+/**
+ *  @name   workspace
+ *  @brief  per thread analysis scratch that outlives a batch call and only ever grows
+ *
+ *  @author Mark Sherman
+ *  @date   10/14/2026
+ *
+ *  A workspace holds everything the batch and the simulator need per set: the priority
+ *  permutation, the global test table, the per core admission contexts with their
+ *  placement column, and the simulator queues. Nothing is freed between sets or between
+ *  calls. Each buffer is sized from the largest set seen so far, so once a workload's
+ *  largest set has gone through, analysis makes no more heap allocations.
+ *
+ *  A workspace belongs to one thread at a time. The parallel driver hands worker k the
+ *  k-th workspace of batch_config_t, see batch.h.
+*/
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <stddef.h>
+
+#include "global.h"
+#include "partition.h"
+
+typedef struct {
+    U32_T           capacity;   // services order and coreOf hold
+    U32_T           *order;
+    U32_T           *coreOf;
+    global_table_t  table;
+    partition_t     part;
+    U32_T           partCores;  // cores part is set up for, 0 until the first partitioned set
+    void            *bytes;     // untyped scratch, the simulator queues
+    size_t          byteCapacity;
+    U64_T           grows;      // allocations so far, flat once the workload is warm
+} feas_workspace_t;
+
+void workspace_init(feas_workspace_t *ws);
+void workspace_free(feas_workspace_t *ws);
+
+/**
+ *  @brief  make order and coreOf hold at least numServices entries
+ *
+ *  @return 0, or -1 if they could not be grown, the old buffers are then kept
+*/
+int workspace_reserve(feas_workspace_t *ws, U32_T numServices);
+
+/**
+ *  @brief  partition state for numCores cores, set up on first use and kept after that
+ *
+ *  @return the partition, or NULL if it could not be allocated
+*/
+partition_t *workspace_partition(feas_workspace_t *ws, U32_T numCores);
+
+/**
+ *  @brief  at least size bytes of scratch aligned like malloc, contents undefined
+ *
+ *  @return the scratch, or NULL if it could not be grown
+*/
+void *workspace_bytes(feas_workspace_t *ws, size_t size);
+
+/**
+ *  @brief  count workspaces set up with workspace_init
+ *
+ *  @return the array, or NULL if it could not be allocated
+*/
+feas_workspace_t *workspace_array(U32_T count);
+
+/**
+ *  @brief  free every workspace of an array from workspace_array, and the array
+*/
+void workspace_array_free(feas_workspace_t *ws, U32_T count);
+
+#endif